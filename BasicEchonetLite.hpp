@@ -0,0 +1,271 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+#include <initializer_list>
+
+/// @brief ヒープを使用しない固定容量のECHONET Liteパケット
+/// @tparam MaxProps 保持可能なプロパティ数（OPC）の上限
+/// @tparam MaxFrameBytes 保持可能なフレーム長の上限
+/// @note プロパティ値データ（EDT）はフレームごとarenaに格納し、ワイヤオーダーのまま参照する
+template <size_t MaxProps, size_t MaxFrameBytes>
+class BasicEchonetLite {
+    static_assert(MaxProps <= std::numeric_limits<uint8_t>::max(), "OPC is 8bit");
+    static_assert(MaxFrameBytes >= EchonetLite::minimumFrameSize, "frame must hold EHD and EDATA");
+    static_assert(MaxFrameBytes <= std::numeric_limits<uint16_t>::max(), "EDT offset is 16bit");
+
+  public:
+    using EchonetLiteHeader       = EchonetLite::EchonetLiteHeader;
+    using EchonetLiteData         = EchonetLite::EchonetLiteData;
+    using EchonetLiteService      = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView    = EchonetLite::EchonetLiteFrameView;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+
+    static constexpr size_t maxProps      = MaxProps;
+    static constexpr size_t maxFrameBytes = MaxFrameBytes;
+
+    /// @brief arena内プロパティの位置
+    struct EchonetLitePayload {
+        uint8_t echonetLiteProperty; // ３．２．７ ECHONET プロパティ（EPC）
+        uint8_t propertyDataCounter; // ３．２．８ プロパティデータカウンタ（PDC）
+        uint16_t offset;             // arena内のEDT先頭位置
+    };
+
+    struct EchonetLitePacket {
+        /// @brief  ECHONET Liteヘッダ
+        EchonetLiteHeader EHEAD;
+        EchonetLiteData EDATA;
+        std::array<EchonetLitePayload, MaxProps> payload;
+        uint8_t payloadCount = 0;
+        /// @brief フレーム（またはEPC・PDC・EDT列）の格納領域
+        std::array<uint8_t, MaxFrameBytes> arena;
+        size_t arenaSize;
+    } data;
+
+    uint16_t nextTransactionId = 0;
+
+    /// @brief EPC→data.payload位置の索引（位置+1、0は該当なし）
+    std::array<uint8_t, 256> propertyIndex = {};
+
+    explicit BasicEchonetLite() {
+        format();
+    }
+
+    void format() {
+        memset(&data.EHEAD, 0, sizeof(data.EHEAD));
+        memset(&data.EDATA, 0, sizeof(data.EDATA));
+        for (uint8_t i = 0; i < data.payloadCount; i++) {
+            propertyIndex[data.payload[i].echonetLiteProperty] = 0;
+        }
+        data.payloadCount              = 0;
+        data.arenaSize                 = 0;
+        data.EHEAD.head1               = EchonetLite::EchonetLiteHeader1::NewEchonetLite;
+        data.EHEAD.head2               = EchonetLite::EchonetLiteHeader2::Type1;
+        data.EHEAD.TransactionId       = nextTransactionId;
+        data.EDATA.SEOJ.classGroupCode = EchonetLite::ClassGroupCode::ManagementOperationDeviceClassGroup;
+        data.EDATA.SEOJ.classCode      = static_cast<uint8_t>(EchonetLite::ClassCode::Controller);
+        data.EDATA.SEOJ.instanceCode   = 0x01;
+        data.EDATA.DEOJ.instanceCode   = 0x01;
+    }
+
+    /// @brief バイナリフレームのパース
+    /// @return プロパティ数またはフレーム長が容量を超えた場合はfalse
+    bool load(const uint8_t *buf, const size_t len) {
+        format();
+        if (len > MaxFrameBytes) {
+            return false;
+        }
+        memcpy(data.arena.data(), buf, len);
+        return loadArena(len);
+    }
+
+    /// @brief レスポンスのパース（arenaへ直接デコード）
+    /// @note 末尾の改行等（16進文字以外）は無視する
+    bool load(const std::string &response) {
+        format();
+        const size_t length = EchonetLite::trimHexLength(response.data(), response.length());
+        const size_t len    = length / 2;
+        if (len > MaxFrameBytes || EchonetLite::decodeHex(response.data(), length, data.arena.data(), data.arena.size()) != len) {
+            return false;
+        }
+        return loadArena(len);
+    }
+
+    /// @brief Get要求リクエストデータ生成
+    /// @return プロパティ数が容量を超えた場合はfalse
+    template <class PropertyType>
+    bool generateGetRequest(const std::initializer_list<PropertyType> property) {
+        if (!beginGetRequest(property.size())) {
+            return false;
+        }
+        for (const PropertyType &prop : property) {
+            addProperty(static_cast<typename std::underlying_type<PropertyType>::type>(prop), 0x00, data.arenaSize);
+        }
+        return true;
+    }
+
+    /// @brief Get要求リクエストデータ生成（EPC列指定）
+    /// @return プロパティ数が容量を超えた場合はfalse
+    bool generateGetRequest(const uint8_t *properties, const size_t count) {
+        if (!beginGetRequest(count)) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            addProperty(properties[i], 0x00, data.arenaSize);
+        }
+        return true;
+    }
+
+    /// @brief EchonetLiteデータサイズ取得
+    size_t size() const {
+        size_t size = EchonetLite::minimumFrameSize;
+        for (uint8_t i = 0; i < data.payloadCount; i++) {
+            size += 2 + data.payload[i].propertyDataCounter;
+        }
+        return size;
+    }
+
+    /// @brief 呼び出し元バッファへバイナリフレームを直接書き込み
+    /// @return 書き込んだバイト数（容量不足の場合は0）
+    size_t serializeTo(uint8_t *const out, const size_t cap) const {
+        if (cap < EchonetLite::minimumFrameSize) {
+            return 0;
+        }
+        size_t length = EchonetLite::serializeHeader(data.EHEAD, data.EDATA, out);
+        for (uint8_t i = 0; i < data.payloadCount; i++) {
+            const EchonetLitePayload &payload = data.payload[i];
+            if (length + 2 + payload.propertyDataCounter > cap) {
+                return 0;
+            }
+            out[length++] = payload.echonetLiteProperty;
+            out[length++] = payload.propertyDataCounter;
+            memcpy(out + length, data.arena.data() + payload.offset, payload.propertyDataCounter);
+            length += payload.propertyDataCounter;
+        }
+        return length;
+    }
+
+    /// @brief 呼び出し元バッファへASCII16進フレームを直接書き込み（SKSENDTOのデータ部用）
+    /// @note 終端文字は付与しない
+    /// @return 書き込んだ文字数（容量不足の場合は0）
+    size_t serializeHexTo(char *const out, const size_t cap) const {
+        uint8_t header[EchonetLite::minimumFrameSize];
+        size_t length = EchonetLite::encodeHex(header, EchonetLite::serializeHeader(data.EHEAD, data.EDATA, header), out, cap);
+        if (length == 0) {
+            return 0;
+        }
+        for (uint8_t i = 0; i < data.payloadCount; i++) {
+            const EchonetLitePayload &payload = data.payload[i];
+            const uint8_t property[]          = {payload.echonetLiteProperty, payload.propertyDataCounter};
+            const size_t propertyLength       = EchonetLite::encodeHex(property, sizeof(property), out + length, cap - length);
+            const size_t payloadLength        = EchonetLite::encodeHex(data.arena.data() + payload.offset, payload.propertyDataCounter, out + length + propertyLength, cap - length - propertyLength);
+            if (propertyLength == 0 || payloadLength != payload.propertyDataCounter * 2u) {
+                return 0;
+            }
+            length += propertyLength + payloadLength;
+        }
+        return length;
+    }
+
+    bool isTransactionIdExpected() const {
+        return data.EHEAD.TransactionId == nextTransactionId;
+    }
+
+    /// @brief 指定EPCのプロパティ検索（索引によるO(1)参照）
+    bool findProperty(const uint8_t prop, EchonetLitePropertyView *const out) const {
+        const uint8_t index = propertyIndex[prop];
+        if (index == 0) {
+            return false;
+        }
+        const EchonetLitePayload &payload = data.payload[index - 1];
+        out->echonetLiteProperty          = payload.echonetLiteProperty;
+        out->propertyDataCounter          = payload.propertyDataCounter;
+        out->payload                      = data.arena.data() + payload.offset;
+        return true;
+    }
+
+    /// @brief レスポンスから特定プロパティのデータ取得（可変長テンプレート）
+    template <class PropertyType, class... PropertyDataTypes>
+    bool getSpecifiedPropertyData(PropertyType prop, PropertyDataTypes *const... data) const {
+        constexpr size_t totalSize = (sizeof(PropertyDataTypes) + ...);
+        EchonetLitePropertyView property;
+        if (!findProperty(static_cast<uint8_t>(prop), &property) || property.propertyDataCounter != totalSize) {
+            return false;
+        }
+        size_t offset    = 0;
+        const bool valid = EchonetLite::copyPropertyDataImpl(property.payload, totalSize, offset, data...);
+        EchonetLiteMetrics::countDecode(property.echonetLiteProperty, valid);
+        return valid;
+    }
+
+    /// @brief レスポンスから特定プロパティのデータ取得（プロパティ定義による型付きデコード）
+    template <class Schema>
+    bool getProperty(const uint8_t prop, typename Schema::value_type *const out) const {
+        EchonetLitePropertyView property;
+        if (!findProperty(prop, &property) || property.propertyDataCounter != Schema::size) {
+            return false;
+        }
+        const bool valid = EchonetLite::decodeProperty<Schema>(property.payload, out);
+        EchonetLiteMetrics::countDecode(prop, valid);
+        return valid;
+    }
+
+    /// @brief 可変長プロパティデータ取得（ワイヤオーダーのままarenaを参照）
+    template <class PropertyType>
+    bool getVariableLengthPropertyData(PropertyType prop, const uint8_t **const out, size_t *const size) const {
+        EchonetLitePropertyView property;
+        if (!findProperty(static_cast<uint8_t>(prop), &property) || property.propertyDataCounter == 0) {
+            return false;
+        }
+        *out  = property.payload;
+        *size = property.propertyDataCounter;
+        return true;
+    }
+
+  private:
+    /// @brief Get要求のヘッダ生成
+    bool beginGetRequest(const size_t count) {
+        format();
+        if (count > MaxProps || EchonetLite::minimumFrameSize + count * 2 > MaxFrameBytes) {
+            return false;
+        }
+        data.EDATA.echonetLiteService       = EchonetLiteService::Get;
+        data.EDATA.operationPropertyCounter = count;
+        data.EHEAD.TransactionId            = ++nextTransactionId;
+        return true;
+    }
+
+    /// @brief プロパティ位置の登録（同一EPCが複数ある場合は先頭を索引に残す）
+    void addProperty(const uint8_t prop, const uint8_t counter, const size_t offset) {
+        data.payload[data.payloadCount] = {
+            .echonetLiteProperty = prop,
+            .propertyDataCounter = counter,
+            .offset              = static_cast<uint16_t>(offset),
+        };
+        data.payloadCount++;
+        if (propertyIndex[prop] == 0) {
+            propertyIndex[prop] = data.payloadCount;
+        }
+    }
+
+    /// @brief arenaに格納したフレームのプロパティ位置を登録
+    bool loadArena(const size_t len) {
+        const EchonetLiteFrameView frame = EchonetLite::load(data.arena.data(), len);
+        if (!frame.valid || frame.EDATA.operationPropertyCounter > MaxProps) {
+            return false;
+        }
+        data.EHEAD     = frame.EHEAD;
+        data.EDATA     = frame.EDATA;
+        data.arenaSize = len;
+        for (const EchonetLitePropertyView property : frame) {
+            addProperty(property.echonetLiteProperty, property.propertyDataCounter, property.payload - data.arena.data());
+        }
+        if (!isTransactionIdExpected()) {
+            EchonetLiteMetrics::countTransactionIdMismatch();
+            return false;
+        }
+        return true;
+    }
+};
+
+/// @brief 低圧スマート電力量メータの定期取得を想定した既定容量
+using EchonetLiteStatic = BasicEchonetLite<16, 256>;
\ No newline at end of file
@@ -3,12 +3,62 @@
 #pragma once
 
 // #include "esp32-hal-log.h"
+#include "EchonetLiteMetrics.hpp"
 #include <algorithm>
+#include <array>
+#include <iterator>
 #include <limits>
 #include <string.h>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+/// @brief プロパティ定義（EDTのフィールド構成・未設定値判定・スケーリング）
+/// @tparam ScaleExponent 物理量への変換倍率（10^ScaleExponent）
+/// @tparam CheckSentinel 範囲外の値を無効とするか（符号付きは最小値・最大値・最大値-1、符号なしは最大値（オーバーフロー）・最大値-1（アンダーフロー））
+/// @tparam Fields EDTを先頭から構成するフィールド型
+template <int8_t ScaleExponent, bool CheckSentinel, class... Fields>
+struct EchonetLitePropertyDescriptor {
+    static_assert(sizeof...(Fields) > 0, "property must have at least one field");
+
+    /// @brief 取得値の型（単一フィールドはその型、複数フィールドはstd::tuple）
+    using value_type = std::conditional_t<sizeof...(Fields) == 1, std::tuple_element_t<0, std::tuple<Fields...>>, std::tuple<Fields...>>;
+
+    /// @brief EDTのバイト数（PDC）
+    static constexpr size_t size = (sizeof(Fields) + ...);
+
+    /// @brief 各フィールドのEDT内オフセット
+    static constexpr std::array<size_t, sizeof...(Fields)> offsets = [] {
+        const size_t sizes[] = {sizeof(Fields)...};
+        std::array<size_t, sizeof...(Fields)> result = {};
+        size_t offset = 0;
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = offset;
+            offset += sizes[i];
+        }
+        return result;
+    }();
+
+    /// @brief 物理量への変換倍率の10の指数
+    static constexpr int8_t scaleExponent = ScaleExponent;
+
+    /// @brief 物理量への変換倍率
+    static constexpr float scale = [] {
+        float result = 1.0f;
+        for (int8_t i = 0; i < ScaleExponent; i++) {
+            result *= 10.0f;
+        }
+        for (int8_t i = 0; i > ScaleExponent; i--) {
+            result /= 10.0f;
+        }
+        return result;
+    }();
+
+    static constexpr bool checkSentinel = CheckSentinel;
+};
+
 class EchonetLite {
   public:
     /// @brief 機器オブジェクトスーパークラス
@@ -41,13 +91,31 @@ class EchonetLite {
         GetPropertyMap                      = 0x9F, ///< Getプロパティマップ
     };
 
+    /// @brief EPCごとのプロパティ定義
+    /// @note 機器クラスごとに部分特殊化する。未定義のEPCをget<>()するとコンパイルエラーとなる
+    template <Property Prop, class = void>
+    struct PropertySchema;
+
+    /// @note 動作状態・異常発生状態は列挙値のため未設定値の判定を行わない。getSpecifiedPropertyData()と異なり
+    ///       0x00・0xFE・0xFFも取得できる
+    template <class Dummy>
+    struct PropertySchema<Property::OperationStatus, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::StandardVersionInformation, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::FaultStatus, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
     enum class ClassGroupCode : uint8_t {
         HousingFacilitiesDeviceClassGroup   = 0x02, // 住宅・設備関連機器クラスグループ
         ManagementOperationDeviceClassGroup = 0x05, // 管理・操作関連機器クラスグループ
+        ProfileClassGroup                   = 0x0E, // プロファイルクラスグループ
     };
 
     enum class ClassCode : uint8_t {
-        Controller = 0xFF, // 住宅・設備関連機器クラスグループ
+        NodeProfile = 0xF0, // ノードプロファイル
+        Controller  = 0xFF, // 住宅・設備関連機器クラスグループ
     };
 
     /// @brief ３.２.１.１ ECHONET Lite ヘッダ１（EHD１）
@@ -96,6 +164,14 @@ class EchonetLite {
         uint8_t instanceCode;
     };
 
+    /// @brief ３．２．２ ECHONET Liteデータ（EDATA）の固定長部分
+    struct EchonetLiteData {
+        EchonetLiteObject SEOJ; // 送信元ECHONET Liteオブジェクト指定
+        EchonetLiteObject DEOJ; // 相手先ECHONET Liteオブジェクト指定
+        EchonetLiteService echonetLiteService;
+        uint8_t operationPropertyCounter; // ３．２．６ 処理対象プロパティカウンタ（OPC、OPCSet、OPCGet）
+    };
+
     struct EchonetLitePayload {
         uint8_t echonetLiteProperty;  // ３．２．７ ECHONET プロパティ（EPC）
         uint8_t propertyDataCounter;  // ３．２．８ プロパティデータカウンタ（PDC）
@@ -105,17 +181,98 @@ class EchonetLite {
     struct EchonetLitePacket {
         /// @brief  ECHONET Liteヘッダ
         EchonetLiteHeader EHEAD;
-        struct {
-            EchonetLiteObject SEOJ; // 送信元ECHONET Liteオブジェクト指定
-            EchonetLiteObject DEOJ; // 相手先ECHONET Liteオブジェクト指定
-            EchonetLiteService echonetLiteService;
-            uint8_t operationPropertyCounter; // ３．２．６ 処理対象プロパティカウンタ（OPC、OPCSet、OPCGet）
-        } EDATA;
+        EchonetLiteData EDATA;
         std::vector<EchonetLitePayload> payload;
     } data;
 
+    /// @brief プロパティ（EPC・PDC・EDT）の非所有ビュー
+    struct EchonetLitePropertyView {
+        uint8_t echonetLiteProperty; // ３．２．７ ECHONET プロパティ（EPC）
+        uint8_t propertyDataCounter; // ３．２．８ プロパティデータカウンタ（PDC）
+        const uint8_t *payload;      // ３．２．９ ECHONET プロパティ値データ（EDT）、ワイヤオーダーのまま参照
+    };
+
+    /// @brief ECHONET Liteフレームの非所有ビュー
+    /// @note 呼び出し元のバッファを参照するため、バッファより長く保持しないこと
+    class EchonetLiteFrameView {
+      public:
+        /// @brief プロパティ列の前方イテレータ
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = EchonetLitePropertyView;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const EchonetLitePropertyView *;
+            using reference         = EchonetLitePropertyView;
+
+            const_iterator(const uint8_t *position, uint8_t remaining) : position(position), remaining(remaining) {}
+
+            EchonetLitePropertyView operator*() const {
+                return {
+                    .echonetLiteProperty = position[0],
+                    .propertyDataCounter = position[1],
+                    .payload             = position + 2,
+                };
+            }
+
+            const_iterator &operator++() {
+                position += 2 + position[1];
+                remaining--;
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const const_iterator &other) const {
+                return remaining == other.remaining;
+            }
+
+            bool operator!=(const const_iterator &other) const {
+                return !(*this == other);
+            }
+
+          private:
+            const uint8_t *position;
+            uint8_t remaining;
+        };
+
+        EchonetLiteHeader EHEAD   = {};
+        EchonetLiteData EDATA     = {};
+        const uint8_t *properties = nullptr; ///< 先頭プロパティ（EPC）位置
+        uint8_t propertyCount     = 0;       ///< 完全に受信できたプロパティ数
+        bool truncated            = false;   ///< OPC分のプロパティを受信できなかった
+        bool valid                = false;   ///< ヘッダを解析できた
+
+        const_iterator begin() const {
+            return const_iterator(properties, propertyCount);
+        }
+
+        const_iterator end() const {
+            return const_iterator(nullptr, 0);
+        }
+
+        /// @brief 指定EPCのプロパティ検索
+        bool find(const uint8_t prop, EchonetLitePropertyView *const out) const {
+            for (const EchonetLitePropertyView property : *this) {
+                if (property.echonetLiteProperty == prop) {
+                    *out = property;
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
     uint16_t nextTransactionId = 0;
 
+    /// @brief EPC→data.payload位置の索引（位置+1、0は該当なし）
+    /// @note load()・generateGetRequest()で構築する。data.payloadを直接編集した場合はindexProperties()で再構築すること
+    std::array<uint8_t, 256> propertyIndex = {};
+
     explicit EchonetLite() {
         format();
     };
@@ -123,6 +280,9 @@ class EchonetLite {
     void format() {
         memset(&data.EHEAD, 0, sizeof(data.EHEAD));
         memset(&data.EDATA, 0, sizeof(data.EDATA));
+        for (const EchonetLitePayload &payload : data.payload) {
+            propertyIndex[payload.echonetLiteProperty] = 0;
+        }
         data.payload.clear();
         data.EHEAD.head1               = EchonetLiteHeader1::NewEchonetLite;
         data.EHEAD.head2               = EchonetLiteHeader2::Type1;
@@ -138,53 +298,125 @@ class EchonetLite {
         // data.payload;
     }
 
-    /// @brief レスポンスのパース
-    bool load(const std::string &response) {
-        format();
-        const size_t responseSize = response.length() / 2;
-        if (responseSize < 12) {
-            return false;
+    /// @brief ECHONET Liteフレームの最小サイズ（EHD + TID + SEOJ + DEOJ + ESV + OPC）
+    static constexpr size_t minimumFrameSize = 12;
+
+    /// @brief 16進文字→値変換テーブル（不正文字は0xFF）
+    static constexpr std::array<uint8_t, 256> hexTable = [] {
+        std::array<uint8_t, 256> table = {};
+        for (size_t i = 0; i < table.size(); i++) {
+            table[i] = 0xFF;
+        }
+        for (uint8_t i = 0; i < 10; i++) {
+            table['0' + i] = i;
+        }
+        for (uint8_t i = 0; i < 6; i++) {
+            table['A' + i] = 10 + i;
+            table['a' + i] = 10 + i;
+        }
+        return table;
+    }();
+
+    /// @brief 末尾の16進文字以外（CR・LF・空白等）を除いた16進文字列長
+    static size_t trimHexLength(const char *hex, size_t length) {
+        while (length > 0 && hexTable[static_cast<uint8_t>(hex[length - 1])] == 0xFF) {
+            length--;
         }
-        std::vector<uint8_t> hexdata(responseSize, 0);
+        return length;
+    }
 
-        for (size_t itr = 0; itr < responseSize; itr++) {
-            hexdata[itr] = strtol(response.substr(itr * 2, 2).c_str(), NULL, 16);
+    /// @brief ASCII16進文字列をバイナリへデコード
+    /// @note 奇数長の末尾1文字は無視する
+    /// @return デコードしたバイト数（不正文字または容量不足の場合は0）
+    static size_t decodeHex(const char *hex, const size_t length, uint8_t *const out, const size_t capacity) {
+        const size_t outSize = length / 2;
+        if (outSize > capacity) {
+            return 0;
+        }
+        for (size_t i = 0; i < outSize; i++) {
+            const uint8_t high = hexTable[static_cast<uint8_t>(hex[i * 2])];
+            const uint8_t low  = hexTable[static_cast<uint8_t>(hex[i * 2 + 1])];
+            if ((high | low) & 0xF0) {
+                return 0;
+            }
+            out[i] = (high << 4) | low;
         }
+        return outSize;
+    }
 
-        data.EHEAD.head1                    = EchonetLiteHeader1(hexdata[0]);
-        data.EHEAD.head2                    = EchonetLiteHeader2(hexdata[1]);
-        data.EHEAD.TransactionId            = (hexdata[3] << 8) + hexdata[2];
-        data.EDATA.SEOJ.classGroupCode      = ClassGroupCode(hexdata[4]);
-        data.EDATA.SEOJ.classCode           = hexdata[5];
-        data.EDATA.SEOJ.instanceCode        = hexdata[6];
-        data.EDATA.DEOJ.classGroupCode      = ClassGroupCode(hexdata[7]);
-        data.EDATA.DEOJ.classCode           = hexdata[8];
-        data.EDATA.DEOJ.instanceCode        = hexdata[9];
-        data.EDATA.echonetLiteService       = EchonetLiteService(hexdata[10]);
-        data.EDATA.operationPropertyCounter = hexdata[11];
+    /// @brief バイナリフレームのパース（ヒープ確保なし）
+    /// @note 戻り値はbufを参照する
+    static EchonetLiteFrameView load(const uint8_t *buf, const size_t len) {
+        EchonetLiteFrameView frame;
+        if (buf == nullptr || len < minimumFrameSize) {
+            EchonetLiteMetrics::countFrame(false, false);
+            return frame;
+        }
 
-        uint8_t counter = 12;
-        for (uint8_t i = 0; i < data.EDATA.operationPropertyCounter; i++) {
-            if (counter + 2 > hexdata.size()) {
+        frame.EHEAD.head1                    = EchonetLiteHeader1(buf[0]);
+        frame.EHEAD.head2                    = EchonetLiteHeader2(buf[1]);
+        frame.EHEAD.TransactionId            = (buf[3] << 8) + buf[2];
+        frame.EDATA.SEOJ.classGroupCode      = ClassGroupCode(buf[4]);
+        frame.EDATA.SEOJ.classCode           = buf[5];
+        frame.EDATA.SEOJ.instanceCode        = buf[6];
+        frame.EDATA.DEOJ.classGroupCode      = ClassGroupCode(buf[7]);
+        frame.EDATA.DEOJ.classCode           = buf[8];
+        frame.EDATA.DEOJ.instanceCode        = buf[9];
+        frame.EDATA.echonetLiteService       = EchonetLiteService(buf[10]);
+        frame.EDATA.operationPropertyCounter = buf[11];
+        frame.properties                     = buf + minimumFrameSize;
+        frame.valid                          = true;
+
+        size_t counter = minimumFrameSize;
+        for (uint8_t i = 0; i < frame.EDATA.operationPropertyCounter; i++) {
+            if (counter + 2 > len || counter + 2 + buf[counter + 1] > len) {
+                frame.truncated = true;
                 break;
             }
+            counter += 2 + buf[counter + 1];
+            frame.propertyCount++;
+        }
+        EchonetLiteMetrics::countFrame(true, frame.truncated);
+        return frame;
+    }
+
+    /// @brief パース済みフレームの取り込み
+    bool load(const EchonetLiteFrameView &frame) {
+        format();
+        if (!frame.valid) {
+            return false;
+        }
+
+        data.EHEAD = frame.EHEAD;
+        data.EDATA = frame.EDATA;
+        data.payload.reserve(frame.propertyCount);
+        for (const EchonetLitePropertyView property : frame) {
             EchonetLitePayload payload = {
-                .echonetLiteProperty = hexdata[counter++],
-                .propertyDataCounter = hexdata[counter++],
-                .payload             = std::vector<uint8_t>(),
+                .echonetLiteProperty = property.echonetLiteProperty,
+                .propertyDataCounter = property.propertyDataCounter,
+                .payload             = std::vector<uint8_t>(property.payload, property.payload + property.propertyDataCounter),
             };
-            for (size_t j = 0; j < payload.propertyDataCounter; j++) {
-                if (counter + j >= hexdata.size()) {
-                    break;
-                }
-                payload.payload.push_back(hexdata[counter + j]);
-            }
-            std::reverse(payload.payload.begin(), payload.payload.end());
-            counter += payload.payload.size();
-            data.payload.push_back(payload);
+            data.payload.push_back(std::move(payload));
         }
+        indexProperties();
 
-        return isTransactionIdExpected();
+        if (!isTransactionIdExpected()) {
+            EchonetLiteMetrics::countTransactionIdMismatch();
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief レスポンスのパース
+    /// @note 末尾の改行等（16進文字以外）は無視する
+    bool load(const std::string &response) {
+        const size_t length = trimHexLength(response.data(), response.length());
+        std::vector<uint8_t> hexdata(length / 2);
+        if (decodeHex(response.data(), length, hexdata.data(), hexdata.size()) != hexdata.size()) {
+            format();
+            return false;
+        }
+        return load(load(hexdata.data(), hexdata.size()));
     }
 
     /// @brief Get要求リクエストデータ生成
@@ -202,6 +434,38 @@ class EchonetLite {
             };
             this->data.payload.push_back(payload);
         }
+        indexProperties();
+    }
+
+    /// @brief Get要求リクエストデータ生成（EPC列指定）
+    void generateGetRequest(const uint8_t *properties, const size_t count) {
+        format();
+        this->data.EDATA.echonetLiteService       = EchonetLiteService::Get;
+        this->data.EDATA.operationPropertyCounter = count;
+        this->data.EHEAD.TransactionId            = ++nextTransactionId;
+        for (size_t i = 0; i < count; i++) {
+            this->data.payload.push_back({
+                .echonetLiteProperty = properties[i],
+                .propertyDataCounter = 0x00,
+                .payload             = std::vector<uint8_t>(),
+            });
+        }
+        indexProperties();
+    }
+
+    /// @brief EPC索引の再構築（同一EPCが複数ある場合は先頭を優先）
+    void indexProperties() {
+        propertyIndex.fill(0);
+        const size_t count = std::min<size_t>(data.payload.size(), std::numeric_limits<uint8_t>::max());
+        for (size_t i = count; i > 0; i--) {
+            propertyIndex[data.payload[i - 1].echonetLiteProperty] = i;
+        }
+    }
+
+    /// @brief 指定EPCのプロパティ検索（索引によるO(1)参照）
+    const EchonetLitePayload *findProperty(const uint8_t prop) const {
+        const uint8_t index = propertyIndex[prop];
+        return index == 0 ? nullptr : &data.payload[index - 1];
     }
 
     bool isTransactionIdExpected() const {
@@ -219,87 +483,247 @@ class EchonetLite {
         return size;
     }
 
-    /// @brief EchonetLiteバイナリデータ取得
-    std::vector<uint8_t> getRawData() const {
-        std::vector<uint8_t> rawData;
-        rawData.reserve(this->size());
-
-        rawData.push_back(static_cast<uint8_t>(data.EHEAD.head1));
-        rawData.push_back(static_cast<uint8_t>(data.EHEAD.head2));
-        rawData.push_back(data.EHEAD.TransactionId & 0xFF);
-        rawData.push_back((data.EHEAD.TransactionId >> 8) & 0xFF);
-
-        rawData.push_back(static_cast<uint8_t>(data.EDATA.SEOJ.classGroupCode));
-        rawData.push_back(data.EDATA.SEOJ.classCode);
-        rawData.push_back(data.EDATA.SEOJ.instanceCode);
-        rawData.push_back(static_cast<uint8_t>(data.EDATA.DEOJ.classGroupCode));
-        rawData.push_back(data.EDATA.DEOJ.classCode);
-        rawData.push_back(data.EDATA.DEOJ.instanceCode);
-        rawData.push_back(static_cast<uint8_t>(data.EDATA.echonetLiteService));
-        rawData.push_back(data.EDATA.operationPropertyCounter);
+    /// @brief EHD・EDATA固定長部分のエンコード
+    /// @return 書き込んだバイト数（minimumFrameSize）
+    static size_t serializeHeader(const EchonetLiteHeader &header, const EchonetLiteData &edata, uint8_t *const out) {
+        out[0]  = static_cast<uint8_t>(header.head1);
+        out[1]  = static_cast<uint8_t>(header.head2);
+        out[2]  = header.TransactionId & 0xFF;
+        out[3]  = (header.TransactionId >> 8) & 0xFF;
+        out[4]  = static_cast<uint8_t>(edata.SEOJ.classGroupCode);
+        out[5]  = edata.SEOJ.classCode;
+        out[6]  = edata.SEOJ.instanceCode;
+        out[7]  = static_cast<uint8_t>(edata.DEOJ.classGroupCode);
+        out[8]  = edata.DEOJ.classCode;
+        out[9]  = edata.DEOJ.instanceCode;
+        out[10] = static_cast<uint8_t>(edata.echonetLiteService);
+        out[11] = edata.operationPropertyCounter;
+        return minimumFrameSize;
+    }
+
+    /// @brief バイナリをASCII16進文字列（大文字）へエンコード
+    /// @return 書き込んだ文字数（容量不足の場合は0）
+    static size_t encodeHex(const uint8_t *in, const size_t length, char *const out, const size_t capacity) {
+        static constexpr char hexChars[] = "0123456789ABCDEF";
+        if (length * 2 > capacity) {
+            return 0;
+        }
+        for (size_t i = 0; i < length; i++) {
+            out[i * 2]     = hexChars[in[i] >> 4];
+            out[i * 2 + 1] = hexChars[in[i] & 0x0F];
+        }
+        return length * 2;
+    }
 
+    /// @brief 呼び出し元バッファへバイナリフレームを直接書き込み
+    /// @return 書き込んだバイト数（容量不足の場合は0）
+    size_t serializeTo(uint8_t *const out, const size_t cap) const {
+        if (cap < minimumFrameSize) {
+            return 0;
+        }
+        size_t length = serializeHeader(data.EHEAD, data.EDATA, out);
+        for (const EchonetLitePayload &payload : this->data.payload) {
+            if (length + 2 + payload.payload.size() > cap) {
+                return 0;
+            }
+            out[length++] = payload.echonetLiteProperty;
+            out[length++] = payload.propertyDataCounter;
+            if (!payload.payload.empty()) {
+                memcpy(out + length, payload.payload.data(), payload.payload.size());
+                length += payload.payload.size();
+            }
+        }
+        return length;
+    }
+
+    /// @brief 呼び出し元バッファへASCII16進フレームを直接書き込み（SKSENDTOのデータ部用）
+    /// @note 終端文字は付与しない
+    /// @return 書き込んだ文字数（容量不足の場合は0）
+    size_t serializeHexTo(char *const out, const size_t cap) const {
+        uint8_t header[minimumFrameSize];
+        size_t length = encodeHex(header, serializeHeader(data.EHEAD, data.EDATA, header), out, cap);
+        if (length == 0) {
+            return 0;
+        }
         for (const EchonetLitePayload &payload : this->data.payload) {
-            rawData.push_back(payload.echonetLiteProperty);
-            rawData.push_back(payload.propertyDataCounter);
-            rawData.insert(rawData.end(), payload.payload.begin(), payload.payload.end());
+            const uint8_t property[]    = {payload.echonetLiteProperty, payload.propertyDataCounter};
+            const size_t propertyLength = encodeHex(property, sizeof(property), out + length, cap - length);
+            const size_t payloadLength  = encodeHex(payload.payload.data(), payload.payload.size(), out + length + propertyLength, cap - length - propertyLength);
+            if (propertyLength == 0 || payloadLength != payload.payload.size() * 2) {
+                return 0;
+            }
+            length += propertyLength + payloadLength;
         }
+        return length;
+    }
 
+    /// @brief EchonetLiteバイナリデータ取得
+    std::vector<uint8_t> getRawData() const {
+        std::vector<uint8_t> rawData(this->size());
+        rawData.resize(serializeTo(rawData.data(), rawData.size()));
         return rawData;
     };
 
+    /// @brief ビッグエンディアン（ワイヤオーダー）のフィールド読み出し
+    template <class T>
+    static T readBigEndian(const uint8_t *payload) {
+        static_assert(std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8), "unsupported field type");
+        using UnsignedType = std::make_unsigned_t<T>;
+        UnsignedType raw;
+        memcpy(&raw, payload, sizeof(raw));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if constexpr (sizeof(T) == 2) {
+            raw = __builtin_bswap16(raw);
+        } else if constexpr (sizeof(T) == 4) {
+            raw = __builtin_bswap32(raw);
+        } else if constexpr (sizeof(T) == 8) {
+            raw = __builtin_bswap64(raw);
+        }
+#endif
+        return static_cast<T>(raw);
+    }
+
+    /// @brief ビッグエンディアン（ワイヤオーダー）のフィールド書き込み
+    template <class T>
+    static void writeBigEndian(const T value, uint8_t *payload) {
+        static_assert(std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8), "unsupported field type");
+        using UnsignedType = std::make_unsigned_t<T>;
+        UnsignedType raw   = static_cast<UnsignedType>(value);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if constexpr (sizeof(T) == 2) {
+            raw = __builtin_bswap16(raw);
+        } else if constexpr (sizeof(T) == 4) {
+            raw = __builtin_bswap32(raw);
+        } else if constexpr (sizeof(T) == 8) {
+            raw = __builtin_bswap64(raw);
+        }
+#endif
+        memcpy(payload, &raw, sizeof(raw));
+    }
+
     /// @brief 取得データのバリデーション（未設定値を除外）
     template <class T>
-    bool isValidValue(const T value) const {
+    static bool isValidValue(const T value) {
         return value != std::numeric_limits<T>::min() && value != std::numeric_limits<T>::max() && value != std::numeric_limits<T>::max() - 1;
     }
 
+    /// @brief プロパティ定義のフィールド値のバリデーション（符号なしは0を有効とする）
+    template <class T>
+    static bool isValidFieldValue(const T value) {
+        if constexpr (std::is_unsigned_v<T>) {
+            return value < std::numeric_limits<T>::max() - 1;
+        } else {
+            return isValidValue(value);
+        }
+    }
+
     /// @brief レスポンスからプロパティデータをコピー（再帰的テンプレート基底ケース）
-    bool copyPropertyDataImpl(const std::vector<uint8_t> &payload, size_t &offset) const {
+    static bool copyPropertyDataImpl(const uint8_t *, const size_t, size_t &) {
         return true;
     }
 
     /// @brief レスポンスからプロパティデータをコピー（再帰的テンプレート）
     template <class PropertyDataType, class... Rest>
-    bool copyPropertyDataImpl(const std::vector<uint8_t> &payload, size_t &offset, PropertyDataType *data, Rest *...rest) const {
-        if (offset + sizeof(PropertyDataType) > payload.size()) {
+    static bool copyPropertyDataImpl(const uint8_t *payload, const size_t size, size_t &offset, PropertyDataType *data, Rest *...rest) {
+        if (offset + sizeof(PropertyDataType) > size) {
             return false;
         }
-        PropertyDataType temp;
-        memcpy(&temp, payload.data() + offset, sizeof(PropertyDataType));
+        const PropertyDataType temp = readBigEndian<PropertyDataType>(payload + offset);
         if (!isValidValue(temp)) {
             return false;
         }
         *data = temp;
         offset += sizeof(PropertyDataType);
-        return copyPropertyDataImpl(payload, offset, rest...);
+        return copyPropertyDataImpl(payload, size, offset, rest...);
     }
 
     /// @brief レスポンスから特定プロパティのデータ取得（可変長テンプレート）
     template <class PropertyType, class... PropertyDataTypes>
     bool getSpecifiedPropertyData(PropertyType prop, PropertyDataTypes *const... data) const {
-        const size_t totalSize = (sizeof(PropertyDataTypes) + ...);
-        const auto result      = std::find_if(this->data.payload.cbegin(), this->data.payload.cend(), [prop, totalSize](const EchonetLite::EchonetLitePayload &payload) {
-            return payload.echonetLiteProperty == static_cast<typename std::underlying_type<PropertyType>::type>(prop) && payload.payload.size() == totalSize;
-        });
+        constexpr size_t totalSize       = (sizeof(PropertyDataTypes) + ...);
+        const EchonetLitePayload *result = findProperty(static_cast<typename std::underlying_type<PropertyType>::type>(prop));
+        if (result == nullptr || result->payload.size() != totalSize) {
+            return false;
+        }
+        size_t offset    = 0;
+        const bool valid = copyPropertyDataImpl(result->payload.data(), result->payload.size(), offset, data...);
+        EchonetLiteMetrics::countDecode(result->echonetLiteProperty, valid);
+        return valid;
+    }
+
+    /// @brief プロパティ定義に従ったフィールドのデコード（固定オフセット）
+    template <class Schema, size_t Index, class FieldType>
+    static bool decodeField(const uint8_t *payload, FieldType *const out) {
+        const FieldType temp = readBigEndian<FieldType>(payload + Schema::offsets[Index]);
+        if constexpr (Schema::checkSentinel) {
+            if (!isValidFieldValue(temp)) {
+                return false;
+            }
+        }
+        *out = temp;
+        return true;
+    }
+
+    /// @brief プロパティ定義に従ったEDTのデコード
+    template <class Schema, size_t... Index>
+    static bool decodeProperty(const uint8_t *payload, typename Schema::value_type *const out, std::index_sequence<Index...>) {
+        if constexpr (sizeof...(Index) == 1) {
+            return decodeField<Schema, 0>(payload, out);
+        } else {
+            return (decodeField<Schema, Index>(payload, &std::get<Index>(*out)) && ...);
+        }
+    }
+
+    /// @brief プロパティ定義に従ったEDTのデコード
+    template <class Schema>
+    static bool decodeProperty(const uint8_t *payload, typename Schema::value_type *const out) {
+        return decodeProperty<Schema>(payload, out, std::make_index_sequence<Schema::offsets.size()>());
+    }
 
-        if (result == this->data.payload.end()) {
+    /// @brief プロパティ定義に従ったEDTのエンコード
+    template <class Schema, size_t... Index>
+    static void encodeProperty(const typename Schema::value_type &value, uint8_t *payload, std::index_sequence<Index...>) {
+        if constexpr (sizeof...(Index) == 1) {
+            writeBigEndian(value, payload);
+        } else {
+            (writeBigEndian(std::get<Index>(value), payload + Schema::offsets[Index]), ...);
+        }
+    }
+
+    /// @brief プロパティ定義に従ったEDTのエンコード
+    /// @return 書き込んだバイト数（PDC）
+    template <class Schema>
+    static size_t encodeProperty(const typename Schema::value_type &value, uint8_t *payload) {
+        encodeProperty<Schema>(value, payload, std::make_index_sequence<Schema::offsets.size()>());
+        return Schema::size;
+    }
+
+    /// @brief レスポンスから特定プロパティのデータ取得（プロパティ定義による型付きデコード）
+    template <class Schema>
+    bool getProperty(const uint8_t prop, typename Schema::value_type *const out) const {
+        const EchonetLitePayload *result = findProperty(prop);
+        if (result == nullptr || result->payload.size() != Schema::size) {
             return false;
         }
-        size_t offset = 0;
-        return copyPropertyDataImpl(result->payload, offset, data...);
+        const bool valid = decodeProperty<Schema>(result->payload.data(), out);
+        EchonetLiteMetrics::countDecode(prop, valid);
+        return valid;
+    }
+
+    /// @brief レスポンスから特定プロパティのデータ取得（機器オブジェクトスーパークラス）
+    template <Property Prop>
+    bool get(typename PropertySchema<Prop>::value_type *const out) const {
+        return getProperty<PropertySchema<Prop>>(static_cast<uint8_t>(Prop), out);
     }
 
     /// @brief 可変長プロパティデータ取得（GetPropertyMap等用）
-    /// @note load()でreverseされたデータを元のワイヤオーダーに戻して返す
+    /// @note EDTはワイヤオーダーのまま返す
     bool getVariableLengthPropertyData(uint8_t prop, std::vector<uint8_t> *out) const {
-        const auto it = std::find_if(this->data.payload.cbegin(), this->data.payload.cend(), [prop](const EchonetLitePayload &payload) {
-            return payload.echonetLiteProperty == prop;
-        });
-        if (it == this->data.payload.end()) {
+        const EchonetLitePayload *it = findProperty(prop);
+        if (it == nullptr) {
             return false;
         }
         *out = it->payload;
-        std::reverse(out->begin(), out->end());
         return !out->empty();
     }
 
@@ -309,8 +733,9 @@ class EchonetLite {
     }
 
     /// @brief 動作状態
+    /// @note 0x00・0xFE・0xFFも有効な値として返す（値の判定は呼び出し元で行う）
     bool getOperationStatus(uint8_t *const installationLocation) const {
-        return getSpecifiedPropertyData(Property::OperationStatus, installationLocation);
+        return get<Property::OperationStatus>(installationLocation);
     }
 
     /// @brief 設置場所
@@ -320,12 +745,13 @@ class EchonetLite {
 
     /// @brief 規格Version情報
     bool getStandardVersionInformation(uint32_t *const standardVersionInformation) const {
-        return getSpecifiedPropertyData(Property::StandardVersionInformation, standardVersionInformation);
+        return get<Property::StandardVersionInformation>(standardVersionInformation);
     }
 
     /// @brief 異常発生状態
+    /// @note 0x00・0xFE・0xFFも有効な値として返す（値の判定は呼び出し元で行う）
     bool getFaultStatus(uint8_t *const faultStatus) const {
-        return getSpecifiedPropertyData(Property::FaultStatus, faultStatus);
+        return get<Property::FaultStatus>(faultStatus);
     }
 
     /// @brief 会員ID／メーカコード
@@ -346,26 +772,47 @@ class EchonetLite {
     /// @brief GetプロパティマップをデコードしてEPCコードのリストとして返す
     /// @see 付録1 プロパティマップ記述形式
     bool getPropertyMapDecoded(std::vector<uint8_t> *out) const {
-        std::vector<uint8_t> raw;
-        if (!getPropertyMap(&raw) || raw.empty()) {
+        const EchonetLitePayload *const payload = findProperty(static_cast<uint8_t>(Property::GetPropertyMap));
+        return payload != nullptr && decodePropertyMap(payload->payload.data(), payload->payload.size(), out);
+    }
+
+    /// @brief プロパティマップ（EDT）をデコードしてEPCコードのリストとして返す
+    /// @see 付録1 プロパティマップ記述形式
+    static bool decodePropertyMap(const uint8_t *raw, const size_t length, std::vector<uint8_t> *out) {
+        out->clear();
+        if (length > 0) {
+            out->reserve(raw[0]);
+        }
+        return forEachPropertyMapEntry(raw, length, [out](const uint8_t prop) { out->push_back(prop); });
+    }
+
+    /// @brief プロパティマップ（EDT）に含まれるEPCコードを順に渡す（リストを確保しない）
+    /// @return EPCコードが1つもない場合はfalse
+    /// @see 付録1 プロパティマップ記述形式
+    template <class Visitor>
+    static bool forEachPropertyMapEntry(const uint8_t *raw, const size_t length, Visitor &&visit) {
+        if (length == 0) {
             return false;
         }
         const uint8_t count = raw[0];
+        bool found          = false;
         if (count < 16) {
             // 記述形式(1): EPCコードをそのまま列挙
-            out->assign(raw.begin() + 1, raw.end());
+            for (size_t n = 1; n < length; n++) {
+                visit(raw[n]);
+                found = true;
+            }
         } else {
             // 記述形式(2): 16バイトビットマップからデコード
-            out->clear();
-            out->reserve(count);
-            for (size_t n = 0; n < 16 && n + 1 < raw.size(); n++) {
+            for (size_t n = 0; n < 16 && n + 1 < length; n++) {
                 for (int b = 0; b < 8; b++) {
                     if (raw[n + 1] & (1 << b)) {
-                        out->push_back(0x80 + n + b * 0x10);
+                        visit(static_cast<uint8_t>(0x80 + n + b * 0x10));
+                        found = true;
                     }
                 }
             }
         }
-        return !out->empty();
+        return found;
     }
-};
+};
\ No newline at end of file
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "LowVoltageSmartElectricEnergyMeter.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+/// @brief 保存済み受信ログ（1行1フレーム）の一括デコーダ
+/// @note 行形式は「[タイムスタンプ] <16進フレーム>」またはERXUDP行（末尾トークンをフレームとして扱う）。
+///       係数（0xD3）・積算電力量単位（0xE1）は別の行で届くことが多く、分割した範囲ごとにはノードの状態を追えないため、
+///       積算電力量は生値のまま出力する。電力量への換算は呼び出し側で同じノードの係数・単位の行を使って行う
+class EchonetLiteBatchDecoder {
+  public:
+    using MeterProperty = LowVoltageSmartElectricEnergyMeterClass::Property;
+
+    /// @brief 1フレームで取得できた列
+    enum class Column : uint16_t {
+        InstantaneousPower          = 1 << 0,
+        InstantaneousCurrents       = 1 << 1,
+        CumulativeEnergyPositiveRaw = 1 << 2,
+        CumulativeEnergyNegativeRaw = 1 << 3,
+        CumulativeEnergyUnitCode    = 1 << 4,
+        Coefficient                 = 1 << 5,
+    };
+
+    /// @brief 列指向のデコード結果
+    /// @note 値はプロパティ定義どおりの生値（電流は0.1A単位、積算電力量は係数・単位適用前、単位は0xE1のコード）
+    struct Result {
+        std::vector<uint64_t> timestamp;                  ///< タイムスタンプ（ERXUDP行は0）
+        std::vector<uint16_t> transactionId;              ///< TID
+        std::vector<uint32_t> sourceObject;               ///< SEOJ（クラスグループ・クラス・インスタンスの24bit）
+        std::vector<uint8_t> service;                     ///< ESV
+        std::vector<uint16_t> columns;                    ///< 取得できた列（Columnの論理和）
+        std::vector<int32_t> instantaneousPower;          ///< 瞬時電力計測値[W]
+        std::vector<int16_t> currentR;                    ///< 瞬時電流計測値（R相）[0.1A]
+        std::vector<int16_t> currentT;                    ///< 瞬時電流計測値（T相）[0.1A]
+        std::vector<int32_t> cumulativeEnergyPositiveRaw; ///< 積算電力量計測値（正方向、係数・単位適用前）
+        std::vector<int32_t> cumulativeEnergyNegativeRaw; ///< 積算電力量計測値（逆方向、係数・単位適用前）
+        std::vector<uint8_t> cumulativeEnergyUnitCode;    ///< 積算電力量単位（0xE1のコード）
+        std::vector<uint32_t> coefficient;                ///< 係数
+        size_t malformed = 0;                             ///< デコードできなかった行数
+
+        size_t size() const {
+            return timestamp.size();
+        }
+
+        bool has(const size_t row, const Column column) const {
+            return columns[row] & static_cast<uint16_t>(column);
+        }
+
+        void reserve(const size_t rows) {
+            forEachColumn([rows](auto &column) { column.reserve(rows); });
+        }
+
+        /// @brief 後続の結果を連結
+        void append(const Result &other) {
+            appendColumn(timestamp, other.timestamp);
+            appendColumn(transactionId, other.transactionId);
+            appendColumn(sourceObject, other.sourceObject);
+            appendColumn(service, other.service);
+            appendColumn(columns, other.columns);
+            appendColumn(instantaneousPower, other.instantaneousPower);
+            appendColumn(currentR, other.currentR);
+            appendColumn(currentT, other.currentT);
+            appendColumn(cumulativeEnergyPositiveRaw, other.cumulativeEnergyPositiveRaw);
+            appendColumn(cumulativeEnergyNegativeRaw, other.cumulativeEnergyNegativeRaw);
+            appendColumn(cumulativeEnergyUnitCode, other.cumulativeEnergyUnitCode);
+            appendColumn(coefficient, other.coefficient);
+            malformed += other.malformed;
+        }
+
+      private:
+        template <class Function>
+        void forEachColumn(Function function) {
+            function(timestamp);
+            function(transactionId);
+            function(sourceObject);
+            function(service);
+            function(columns);
+            function(instantaneousPower);
+            function(currentR);
+            function(currentT);
+            function(cumulativeEnergyPositiveRaw);
+            function(cumulativeEnergyNegativeRaw);
+            function(cumulativeEnergyUnitCode);
+            function(coefficient);
+        }
+
+        template <class T>
+        static void appendColumn(std::vector<T> &to, const std::vector<T> &from) {
+            to.insert(to.end(), from.begin(), from.end());
+        }
+    };
+
+    /// @brief ERXUDPで受信し得る最大フレーム長
+    static constexpr size_t maxFrameBytes = 1232;
+
+    /// @brief 連続バッファの一括デコード
+    /// @param threads 分割数（Linux以外では常に1）
+    static Result decode(const char *buffer, const size_t length, unsigned threads = 1) {
+#if defined(__linux__)
+        if (threads > 1 && length > threads) {
+            std::vector<Result> results(threads);
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            size_t begin = 0;
+            for (unsigned i = 0; i < threads; i++) {
+                size_t end = (i + 1 == threads) ? length : std::max(begin, length * (i + 1) / threads);
+                while (end < length && buffer[end - 1] != '\n') {
+                    end++;
+                }
+                workers.emplace_back([&results, i, buffer, begin, end] { results[i] = decodeRange(buffer + begin, end - begin); });
+                begin = end;
+            }
+            for (std::thread &worker : workers) {
+                worker.join();
+            }
+            Result result = std::move(results[0]);
+            for (unsigned i = 1; i < threads; i++) {
+                result.append(results[i]);
+            }
+            return result;
+        }
+#endif
+        (void)threads;
+        return decodeRange(buffer, length);
+    }
+
+#if defined(__linux__)
+    /// @brief ファイルをメモリマップして一括デコード
+    /// @return ファイルを開けなかった場合はfalse
+    static bool decodeFile(const char *path, Result *const result, const unsigned threads = std::thread::hardware_concurrency()) {
+        const int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return false;
+        }
+        if (st.st_size == 0) {
+            close(fd);
+            *result = Result();
+            return true;
+        }
+        void *mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+        madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+        *result = decode(static_cast<const char *>(mapped), st.st_size, std::max(1u, threads));
+        munmap(mapped, st.st_size);
+        return true;
+    }
+#endif
+
+    /// @brief 1行のデコード
+    /// @return フレームを解析できた場合はtrue（先頭トークンが数字のみでもERXUDPでもない行はfalse）
+    static bool decodeLine(const char *line, const size_t length, Result *const result) {
+        // 末尾トークンをフレーム、先頭トークンをタイムスタンプとする
+        size_t end = length;
+        while (end > 0 && isSeparator(line[end - 1])) {
+            end--;
+        }
+        size_t begin = end;
+        while (begin > 0 && !isSeparator(line[begin - 1])) {
+            begin--;
+        }
+        size_t first = 0;
+        while (first < begin && isSeparator(line[first])) {
+            first++;
+        }
+        uint64_t timestamp = 0;
+        if (first < begin && !parseTimestamp(line + first, begin - first, &timestamp)) {
+            return false;
+        }
+
+        uint8_t frame[maxFrameBytes];
+        const size_t frameLength = EchonetLite::decodeHex(line + begin, end - begin, frame, sizeof(frame));
+        const EchonetLite::EchonetLiteFrameView view = EchonetLite::load(frame, frameLength);
+        if (frameLength == 0 || !view.valid) {
+            return false;
+        }
+
+        uint16_t columns = 0;
+        int32_t power = 0, energyPositive = 0, energyNegative = 0;
+        std::tuple<int16_t, int16_t> currents = {0, 0};
+        uint8_t unit = 0;
+        uint32_t ratio = 0;
+        for (const EchonetLite::EchonetLitePropertyView property : view) {
+            switch (static_cast<MeterProperty>(property.echonetLiteProperty)) {
+                case MeterProperty::InstantaneousPower:
+                    columns |= decodeColumn<MeterProperty::InstantaneousPower>(property, &power, Column::InstantaneousPower);
+                    break;
+                case MeterProperty::InstantaneousCurrents:
+                    columns |= decodeColumn<MeterProperty::InstantaneousCurrents>(property, &currents, Column::InstantaneousCurrents);
+                    break;
+                case MeterProperty::CumulativeEnergyPositive:
+                    columns |= decodeColumn<MeterProperty::CumulativeEnergyPositive>(property, &energyPositive, Column::CumulativeEnergyPositiveRaw);
+                    break;
+                case MeterProperty::CumulativeEnergyNegative:
+                    columns |= decodeColumn<MeterProperty::CumulativeEnergyNegative>(property, &energyNegative, Column::CumulativeEnergyNegativeRaw);
+                    break;
+                case MeterProperty::CumulativeEnergyUnit:
+                    columns |= decodeColumn<MeterProperty::CumulativeEnergyUnit>(property, &unit, Column::CumulativeEnergyUnitCode);
+                    break;
+                case MeterProperty::Coefficient:
+                    columns |= decodeColumn<MeterProperty::Coefficient>(property, &ratio, Column::Coefficient);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        result->timestamp.push_back(timestamp);
+        result->transactionId.push_back(view.EHEAD.TransactionId);
+        result->sourceObject.push_back((static_cast<uint32_t>(view.EDATA.SEOJ.classGroupCode) << 16) | (view.EDATA.SEOJ.classCode << 8) | view.EDATA.SEOJ.instanceCode);
+        result->service.push_back(static_cast<uint8_t>(view.EDATA.echonetLiteService));
+        result->columns.push_back(columns);
+        result->instantaneousPower.push_back(power);
+        result->currentR.push_back(std::get<0>(currents));
+        result->currentT.push_back(std::get<1>(currents));
+        result->cumulativeEnergyPositiveRaw.push_back(energyPositive);
+        result->cumulativeEnergyNegativeRaw.push_back(energyNegative);
+        result->cumulativeEnergyUnitCode.push_back(unit);
+        result->coefficient.push_back(ratio);
+        return true;
+    }
+
+  private:
+    static bool isSeparator(const char c) {
+        return c == ' ' || c == ',' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    /// @brief 先頭トークンのタイムスタンプ解析（ERXUDP行は0）
+    /// @return 数字以外を含む・uint64_tに収まらない場合はfalse
+    static bool parseTimestamp(const char *token, const size_t length, uint64_t *const timestamp) {
+        constexpr char erxudp[] = "ERXUDP";
+        size_t tokenLength      = 0;
+        while (tokenLength < length && !isSeparator(token[tokenLength])) {
+            tokenLength++;
+        }
+        if (tokenLength == sizeof(erxudp) - 1 && memcmp(token, erxudp, tokenLength) == 0) {
+            *timestamp = 0;
+            return true;
+        }
+        uint64_t value = 0;
+        for (size_t i = 0; i < tokenLength; i++) {
+            if (token[i] < '0' || token[i] > '9' || value > (std::numeric_limits<uint64_t>::max() - (token[i] - '0')) / 10) {
+                return false;
+            }
+            value = value * 10 + (token[i] - '0');
+        }
+        *timestamp = value;
+        return true;
+    }
+
+    /// @brief メータクラスのプロパティ定義でEDTをデコード
+    template <MeterProperty Prop>
+    static uint16_t decodeColumn(const EchonetLite::EchonetLitePropertyView &property, typename LowVoltageSmartElectricEnergyMeterClass::PropertySchema<Prop>::value_type *const out, const Column column) {
+        using Schema = LowVoltageSmartElectricEnergyMeterClass::PropertySchema<Prop>;
+        if (property.propertyDataCounter != Schema::size || !EchonetLite::decodeProperty<Schema>(property.payload, out)) {
+            return 0;
+        }
+        return static_cast<uint16_t>(column);
+    }
+
+    /// @brief 行単位でのデコード（スレッドごとに呼び出す）
+    static Result decodeRange(const char *buffer, const size_t length) {
+        Result result;
+        result.reserve(std::count(buffer, buffer + length, '\n') + 1);
+        size_t begin = 0;
+        while (begin < length) {
+            const char *newline = static_cast<const char *>(memchr(buffer + begin, '\n', length - begin));
+            const size_t end    = newline == nullptr ? length : newline - buffer;
+            if (end > begin && !decodeLine(buffer + begin, end - begin, &result)) {
+                result.malformed++;
+            }
+            begin = end + 1;
+        }
+        return result;
+    }
+};
\ No newline at end of file
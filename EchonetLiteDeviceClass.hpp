@@ -0,0 +1,103 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+
+/// @brief 機器オブジェクトクラスの共通実装（CRTP）
+/// @details 派生クラスはProperty列挙型とPropertySchemaの特殊化を宣言するだけで、DEOJを設定したGet要求生成・
+///          レスポンスの取り込み・プロパティ定義による型付きのget<>()・encode<>()を得る。呼び出しは全て静的に解決し、
+///          仮想関数・実行時テーブルを持たない
+/// @tparam Derived 機器オブジェクトクラス
+/// @tparam Group クラスグループコード
+/// @tparam Class クラスコード
+/// @note 派生クラスでonLoad()を定義した場合はレスポンス取り込み後に呼び出す（protectedにする場合は基底クラスをfriendにする）
+template <class Derived, EchonetLite::ClassGroupCode Group, uint8_t Class>
+class EchonetLiteDeviceClass : public EchonetLite {
+    /// @brief プロパティ定義の解決（派生クラスのプロパティ）
+    template <auto Prop, class = void>
+    struct SchemaOf {
+        using type = typename Derived::template PropertySchema<Prop>;
+    };
+
+    /// @brief プロパティ定義の解決（機器オブジェクトスーパークラスのプロパティ）
+    template <auto Prop>
+    struct SchemaOf<Prop, std::enable_if_t<std::is_same_v<decltype(Prop), EchonetLite::Property>>> {
+        using type = EchonetLite::PropertySchema<Prop>;
+    };
+
+  public:
+    static constexpr ClassGroupCode classGroupCode = Group;
+    static constexpr uint8_t classCode             = Class;
+
+    /// @brief プロパティ定義（派生クラス・機器オブジェクトスーパークラスのどちらのプロパティも指定できる）
+    template <auto Prop>
+    using PropertySchemaOf = typename SchemaOf<Prop>::type;
+
+    /// @brief 機器オブジェクトのEOJ
+    static constexpr EchonetLiteObject eoj(const uint8_t instanceCode = 0x01) {
+        return {Group, Class, instanceCode};
+    }
+
+    /// @brief このクラスのオブジェクトか（インスタンスコードは問わない）
+    static constexpr bool isInstance(const EchonetLiteObject &object) {
+        return object.classGroupCode == Group && object.classCode == Class;
+    }
+
+    /// @brief Get要求リクエストデータ生成
+    template <class PropertyType>
+    void generateGetRequest(const std::vector<PropertyType> &property) {
+        EchonetLite::generateGetRequest(property);
+        setDestinationClass();
+    }
+
+    /// @brief Get要求リクエストデータ生成（EPC列指定）
+    void generateGetRequest(const uint8_t *properties, const size_t count) {
+        EchonetLite::generateGetRequest(properties, count);
+        setDestinationClass();
+    }
+
+    /// @brief Get要求リクエストデータ生成（コンパイル時のEPC列指定）
+    template <auto... Props>
+    void generateGetRequest() {
+        static constexpr uint8_t properties[] = {static_cast<uint8_t>(Props)...};
+        generateGetRequest(properties, sizeof...(Props));
+    }
+
+    using EchonetLite::load;
+
+    /// @brief パース済みフレームの取り込み
+    bool load(const EchonetLiteFrameView &frame) {
+        const bool result = EchonetLite::load(frame);
+        static_cast<Derived *>(this)->onLoad();
+        return result;
+    }
+
+    /// @brief レスポンスのパース
+    bool load(const std::string &response) {
+        const bool result = EchonetLite::load(response);
+        static_cast<Derived *>(this)->onLoad();
+        return result;
+    }
+
+    /// @brief レスポンスから特定プロパティのデータ取得
+    template <auto Prop>
+    bool get(typename PropertySchemaOf<Prop>::value_type *const out) const {
+        return getProperty<PropertySchemaOf<Prop>>(static_cast<uint8_t>(Prop), out);
+    }
+
+    /// @brief プロパティ値のEDTエンコード（ワイヤオーダー）
+    /// @return 書き込んだバイト数（PDC）
+    template <auto Prop>
+    static size_t encode(const typename PropertySchemaOf<Prop>::value_type &value, uint8_t *const edt) {
+        return encodeProperty<PropertySchemaOf<Prop>>(value, edt);
+    }
+
+  protected:
+    /// @brief レスポンス取り込み後の処理（派生クラスで再定義する）
+    void onLoad() {}
+
+  private:
+    void setDestinationClass() {
+        data.EDATA.DEOJ.classGroupCode = Group;
+        data.EDATA.DEOJ.classCode      = Class;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,359 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+#include <bitset>
+#include <functional>
+
+/// @brief 機器側（サーバ）として要求に応答するECHONET Liteオブジェクト
+/// @details 登録したプロパティテーブルからGet・SetC・SetI・SetGet・INF_REQに応答する。
+///          状変アナウンス・Set・Getプロパティマップ（0x9D・0x9E・0x9F）は登録内容から自動生成する
+/// @tparam MaxProps 登録できるプロパティ数（プロパティマップを含む）
+/// @tparam MaxValueBytes 1プロパティあたりのEDT長の上限
+/// @note 応答生成は呼び出し元のバッファへ直接書き込み、ヒープを確保しない
+template <size_t MaxProps = 32, size_t MaxValueBytes = 32>
+class EchonetLiteDeviceObject {
+    static_assert(MaxValueBytes >= 17, "property map needs 17 bytes");
+    static_assert(MaxProps <= std::numeric_limits<uint8_t>::max(), "property index is 8bit");
+
+  public:
+    using Property                = EchonetLite::Property;
+    using EchonetLiteObject       = EchonetLite::EchonetLiteObject;
+    using EchonetLiteService      = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView    = EchonetLite::EchonetLiteFrameView;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+
+    /// @brief プロパティのアクセスルール
+    enum Access : uint8_t {
+        Get      = 1 << 0,
+        Set      = 1 << 1,
+        Announce = 1 << 2, ///< 状変時アナウンス
+    };
+
+    /// @brief Set要求の受理判定（falseで不可応答）
+    using SetValidator = std::function<bool(const EchonetLitePropertyView &property)>;
+
+    const EchonetLiteObject object;
+
+    explicit EchonetLiteDeviceObject(const EchonetLiteObject &object) : object(object) {
+        updatePropertyMaps();
+    }
+
+    /// @brief プロパティの登録
+    /// @return 登録数・値の長さが上限を超えた場合はfalse
+    bool addProperty(const uint8_t prop, const uint8_t access, const uint8_t *value = nullptr, const uint8_t length = 0) {
+        if (isPropertyMap(prop) || length > MaxValueBytes || (propertyIndex[prop] == 0 && count >= MaxProps)) {
+            return false;
+        }
+        if (propertyIndex[prop] == 0) {
+            properties[count] = {.property = prop, .access = access, .length = 0, .value = {}};
+            count++;
+            propertyIndex[prop] = count;
+        }
+        Entry &entry = properties[propertyIndex[prop] - 1];
+        entry.access = access;
+        entry.length = length;
+        if (length > 0) {
+            memcpy(entry.value.data(), value, length);
+        }
+        updatePropertyMaps();
+        return true;
+    }
+
+    template <class PropertyType, typename std::enable_if_t<std::is_enum_v<PropertyType>, int> = 0>
+    bool addProperty(const PropertyType prop, const uint8_t access, const uint8_t *value = nullptr, const uint8_t length = 0) {
+        return addProperty(static_cast<uint8_t>(prop), access, value, length);
+    }
+
+    /// @brief プロパティ値の更新（機器内部からの更新。アクセスルールは問わない）
+    bool setPropertyValue(const uint8_t prop, const uint8_t *value, const uint8_t length) {
+        Entry *const entry = findEntry(prop);
+        if (entry == nullptr || isPropertyMap(prop) || length > MaxValueBytes) {
+            return false;
+        }
+        memcpy(entry->value.data(), value, length);
+        entry->length = length;
+        return true;
+    }
+
+    /// @brief プロパティ値の参照
+    bool getPropertyValue(const uint8_t prop, EchonetLitePropertyView *const out) const {
+        const uint8_t index = propertyIndex[prop];
+        if (index == 0) {
+            return false;
+        }
+        const Entry &entry       = properties[index - 1];
+        out->echonetLiteProperty = entry.property;
+        out->propertyDataCounter = entry.length;
+        out->payload             = entry.value.data();
+        return true;
+    }
+
+    /// @brief Set要求の受理判定の設定
+    void setSetValidator(SetValidator validator) {
+        setValidator = std::move(validator);
+    }
+
+    /// @brief プロパティマップのエンコード
+    /// @see 付録1 プロパティマップ記述形式
+    /// @return 書き込んだバイト数
+    static size_t encodePropertyMap(const uint8_t *props, const size_t propertyCount, uint8_t *const out) {
+        out[0] = propertyCount;
+        if (propertyCount < 16) {
+            // 記述形式(1): EPCコードをそのまま列挙
+            memcpy(out + 1, props, propertyCount);
+            return 1 + propertyCount;
+        }
+        // 記述形式(2): 16バイトビットマップ
+        memset(out + 1, 0, 16);
+        for (size_t i = 0; i < propertyCount; i++) {
+            if (props[i] >= 0x80) {
+                out[1 + (props[i] & 0x0F)] |= 1 << ((props[i] - 0x80) >> 4);
+            }
+        }
+        return 17;
+    }
+
+    /// @brief 要求フレームへの応答生成
+    /// @return 応答フレーム長（宛先が異なる・応答不要・バッファ不足の場合は0）
+    /// @note 受理したSet要求の値はプロパティテーブルへ反映する。応答がバッファに収まらない場合は反映しない
+    size_t handle(const uint8_t *request, const size_t length, uint8_t *const response, const size_t capacity) {
+        const EchonetLiteFrameView frame = EchonetLite::load(request, length);
+        if (!frame.valid || frame.truncated || !isAddressedTo(frame.EDATA.DEOJ) || capacity < EchonetLite::minimumFrameSize) {
+            return 0;
+        }
+
+        Writer writer = {response, capacity, EchonetLite::minimumFrameSize, true};
+        bool accepted = true;
+        Acceptance setAccepted;
+        EchonetLiteService service;
+        switch (frame.EDATA.echonetLiteService) {
+            case EchonetLiteService::Get:
+                accepted = writeGet(frame, &writer);
+                service  = accepted ? EchonetLiteService::Get_Res : EchonetLiteService::Get_SNA;
+                break;
+            case EchonetLiteService::INF_REQ:
+                accepted = writeGet(frame, &writer);
+                service  = accepted ? EchonetLiteService::INF : EchonetLiteService::INF_SNA;
+                break;
+            case EchonetLiteService::SetC:
+                accepted = writeSet(frame, &setAccepted, &writer);
+                service  = accepted ? EchonetLiteService::Set_Res : EchonetLiteService::SetC_SNA;
+                break;
+            case EchonetLiteService::SetI:
+                accepted = writeSet(frame, &setAccepted, &writer);
+                if (accepted) {
+                    // SetIは受理時に応答しない
+                    applySet(frame, setAccepted);
+                    return 0;
+                }
+                service = EchonetLiteService::SetI_SNA;
+                break;
+            case EchonetLiteService::SetGet:
+                accepted = writeSetGet(frame, request + length, &setAccepted, &writer);
+                service  = accepted ? EchonetLiteService::SetGet_Res : EchonetLiteService::SetGet_SNA;
+                break;
+            default:
+                return 0;
+        }
+        if (!writer.ok) {
+            return 0;
+        }
+        // 応答が確定してから反映する（不可応答でも受理したプロパティは反映する）
+        applySet(frame, setAccepted);
+
+        EchonetLite::EchonetLiteData edata = frame.EDATA;
+        edata.SEOJ                         = object;
+        edata.DEOJ                         = frame.EDATA.SEOJ;
+        edata.echonetLiteService           = service;
+        EchonetLite::serializeHeader(frame.EHEAD, edata, response);
+        return writer.length;
+    }
+
+  private:
+    /// @brief Set部の位置ごとの受理判定結果
+    using Acceptance = std::bitset<256>;
+
+    struct Entry {
+        uint8_t property;
+        uint8_t access;
+        uint8_t length;
+        std::array<uint8_t, MaxValueBytes> value;
+    };
+
+    /// @brief 応答の書き込み先
+    struct Writer {
+        uint8_t *out;
+        size_t capacity;
+        size_t length;
+        bool ok;
+
+        void put(const uint8_t prop, const uint8_t counter, const uint8_t *value) {
+            if (!ok || length + 2 + counter > capacity) {
+                ok = false;
+                return;
+            }
+            out[length++] = prop;
+            out[length++] = counter;
+            if (counter > 0) {
+                memcpy(out + length, value, counter);
+                length += counter;
+            }
+        }
+
+        void putByte(const uint8_t value) {
+            if (!ok || length + 1 > capacity) {
+                ok = false;
+                return;
+            }
+            out[length++] = value;
+        }
+    };
+
+    std::array<Entry, MaxProps> properties;
+    std::array<uint8_t, 256> propertyIndex = {};
+    size_t count                           = 0;
+    SetValidator setValidator;
+
+    static bool isPropertyMap(const uint8_t prop) {
+        return prop == static_cast<uint8_t>(Property::StatusChangeAnnouncementPropertyMap) || prop == static_cast<uint8_t>(Property::SetPropertyMap) || prop == static_cast<uint8_t>(Property::GetPropertyMap);
+    }
+
+    Entry *findEntry(const uint8_t prop) {
+        const uint8_t index = propertyIndex[prop];
+        return index == 0 ? nullptr : &properties[index - 1];
+    }
+
+    const Entry *findEntry(const uint8_t prop) const {
+        const uint8_t index = propertyIndex[prop];
+        return index == 0 ? nullptr : &properties[index - 1];
+    }
+
+    /// @brief 宛先判定（インスタンスコード0x00は全インスタンス宛）
+    bool isAddressedTo(const EchonetLiteObject &destination) const {
+        return destination.classGroupCode == object.classGroupCode && destination.classCode == object.classCode && (destination.instanceCode == 0x00 || destination.instanceCode == object.instanceCode);
+    }
+
+    /// @brief プロパティマップの再生成
+    void updatePropertyMaps() {
+        constexpr Property maps[]  = {Property::StatusChangeAnnouncementPropertyMap, Property::SetPropertyMap, Property::GetPropertyMap};
+        constexpr uint8_t access[] = {Announce, Set, Get};
+        for (const Property map : maps) {
+            const uint8_t prop = static_cast<uint8_t>(map);
+            if (propertyIndex[prop] == 0 && count < MaxProps) {
+                properties[count] = {.property = prop, .access = Get, .length = 0, .value = {}};
+                count++;
+                propertyIndex[prop] = count;
+            }
+        }
+        for (size_t i = 0; i < std::size(maps); i++) {
+            Entry *const entry = findEntry(static_cast<uint8_t>(maps[i]));
+            if (entry == nullptr) {
+                continue;
+            }
+            uint8_t props[MaxProps];
+            size_t propertyCount = 0;
+            for (size_t j = 0; j < count; j++) {
+                if (properties[j].access & access[i]) {
+                    props[propertyCount++] = properties[j].property;
+                }
+            }
+            entry->length = encodePropertyMap(props, propertyCount, entry->value.data());
+        }
+    }
+
+    /// @brief Get・INF_REQの応答プロパティ書き込み
+    bool writeGet(const EchonetLiteFrameView &frame, Writer *const writer) const {
+        bool accepted = true;
+        for (const EchonetLitePropertyView property : frame) {
+            const Entry *const entry = findEntry(property.echonetLiteProperty);
+            if (entry != nullptr && (entry->access & Get)) {
+                writer->put(entry->property, entry->length, entry->value.data());
+            } else {
+                writer->put(property.echonetLiteProperty, 0, nullptr);
+                accepted = false;
+            }
+        }
+        return accepted;
+    }
+
+    /// @brief SetC・SetIの応答プロパティ書き込み（受理したプロパティはPDC=0）
+    /// @note 値は反映せず、受理判定をacceptedに記録する
+    bool writeSet(const EchonetLiteFrameView &frame, Acceptance *const accepted, Writer *const writer) const {
+        bool allAccepted = true;
+        size_t position  = 0;
+        for (const EchonetLitePropertyView property : frame) {
+            const Entry *const entry = findEntry(property.echonetLiteProperty);
+            const bool accept        = entry != nullptr && (entry->access & Set) && property.propertyDataCounter > 0 && property.propertyDataCounter <= MaxValueBytes && (!setValidator || setValidator(property));
+            accepted->set(position++, accept);
+            if (accept) {
+                writer->put(property.echonetLiteProperty, 0, nullptr);
+            } else {
+                writer->put(property.echonetLiteProperty, property.propertyDataCounter, property.payload);
+                allAccepted = false;
+            }
+        }
+        return allAccepted;
+    }
+
+    /// @brief 受理したSet要求の値の反映
+    void applySet(const EchonetLiteFrameView &frame, const Acceptance &accepted) {
+        size_t position = 0;
+        for (const EchonetLitePropertyView property : frame) {
+            if (accepted.test(position++)) {
+                Entry *const entry = findEntry(property.echonetLiteProperty);
+                memcpy(entry->value.data(), property.payload, property.propertyDataCounter);
+                entry->length = property.propertyDataCounter;
+            }
+        }
+    }
+
+    /// @brief 受理したSet要求を反映した後の値の参照（同じEPCが複数ある場合は後のもの）
+    /// @return Set部で受理していない場合はfalse
+    static bool findAcceptedValue(const EchonetLiteFrameView &frame, const Acceptance &accepted, const uint8_t prop, EchonetLitePropertyView *const out) {
+        bool found      = false;
+        size_t position = 0;
+        for (const EchonetLitePropertyView property : frame) {
+            if (accepted.test(position++) && property.echonetLiteProperty == prop) {
+                *out  = property;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    /// @brief SetGetの応答プロパティ書き込み（OPCSet・Set部・OPCGet・Get部）
+    /// @note Get部はSet部を反映した後の値で応答する
+    bool writeSetGet(const EchonetLiteFrameView &frame, const uint8_t *const frameEnd, Acceptance *const accepted, Writer *const writer) const {
+        const bool setAccepted = writeSet(frame, accepted, writer);
+        const uint8_t *get     = frame.properties;
+        for (const EchonetLitePropertyView property : frame) {
+            get = property.payload + property.propertyDataCounter;
+        }
+        if (get >= frameEnd) {
+            writer->ok = false;
+            return false;
+        }
+        const uint8_t getCount = *get++;
+        writer->putByte(getCount);
+        bool getAccepted = true;
+        for (uint8_t i = 0; i < getCount; i++) {
+            if (get + 2 > frameEnd) {
+                writer->ok = false;
+                return false;
+            }
+            const uint8_t prop = get[0];
+            get += 2 + get[1];
+            const Entry *const entry = findEntry(prop);
+            EchonetLitePropertyView value;
+            if (entry == nullptr || !(entry->access & Get)) {
+                writer->put(prop, 0, nullptr);
+                getAccepted = false;
+            } else if (findAcceptedValue(frame, *accepted, prop, &value)) {
+                writer->put(prop, value.propertyDataCounter, value.payload);
+            } else {
+                writer->put(entry->property, entry->length, entry->value.data());
+            }
+        }
+        return setAccepted && getAccepted;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "EchonetLiteNodeRegistry.hpp"
+
+/// @brief ノード探索
+/// @details ノードプロファイル（0x0EF001）の自ノードインスタンスリストS（0xD6）をマルチキャストでGetし、
+///          応答待ち時間内の応答およびインスタンスリスト通知（0xD5）から機器オブジェクトを登録する。
+///          登録したオブジェクトのプロパティマップは並行して取得する
+/// @note 時刻は呼び出し元のミリ秒カウンタで与える
+class EchonetLiteDiscovery {
+  public:
+    using NodeAddress          = EchonetLiteNodeRegistry::NodeAddress;
+    using Sender               = EchonetLiteNodeRegistry::Sender;
+    using EchonetLiteObject    = EchonetLite::EchonetLiteObject;
+    using EchonetLiteService   = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView = EchonetLite::EchonetLiteFrameView;
+    using Request              = BasicEchonetLite<3, EchonetLite::minimumFrameSize + 3 * 2>;
+
+    /// @brief ノードプロファイルのプロパティ
+    enum class Property : uint8_t {
+        NumberOfSelfNodeInstances = 0xD3, ///< 自ノードインスタンス数
+        NumberOfSelfNodeClasses   = 0xD4, ///< 自ノードクラス数
+        InstanceListNotification  = 0xD5, ///< インスタンスリスト通知
+        SelfNodeInstanceListS     = 0xD6, ///< 自ノードインスタンスリストS
+        SelfNodeClassListS        = 0xD7, ///< 自ノードクラスリストS
+    };
+
+    /// @brief マルチキャスト送信（フレーム）
+    using MulticastSender = std::function<bool(const uint8_t *frame, size_t length)>;
+
+    /// @brief ノードプロファイルのEOJ
+    static constexpr EchonetLiteObject nodeProfile = {EchonetLite::ClassGroupCode::ProfileClassGroup, static_cast<uint8_t>(EchonetLite::ClassCode::NodeProfile), 0x01};
+
+    uint32_t responseWindow = 5000; ///< 探索要求後に応答を待つ時間[ms]
+    uint32_t requestTimeout = 3000; ///< プロパティマップ要求の応答待ち時間[ms]
+    uint8_t maxRetries      = 2;    ///< プロパティマップ要求の再送回数
+    size_t maxInFlight      = 64;   ///< 並行して応答を待つプロパティマップ要求数
+
+    explicit EchonetLiteDiscovery(EchonetLiteNodeRegistry &registry)
+        : registry(registry) {
+    }
+
+    /// @brief 探索要求の送信と応答待ちの開始
+    /// @return 送信できなかった場合はfalse
+    bool start(const uint32_t now, const MulticastSender &sender) {
+        Request request;
+        request.nextTransactionId = registry.nextTransactionId;
+        const uint8_t props[]     = {static_cast<uint8_t>(Property::SelfNodeInstanceListS)};
+        request.generateGetRequest(props, std::size(props));
+        request.data.EDATA.DEOJ    = nodeProfile;
+        registry.nextTransactionId = request.nextTransactionId;
+
+        uint8_t frame[Request::maxFrameBytes];
+        if (!sender(frame, request.serializeTo(frame, sizeof(frame)))) {
+            return false;
+        }
+        windowEnd = now + responseWindow;
+        searching = true;
+        return true;
+    }
+
+    /// @brief 受信フレームの取り込み
+    /// @details インスタンスリストを含む場合はノードの機器オブジェクトを登録し、プロパティマップ取得を予約する。
+    ///          フレームはレジストリにも渡す
+    /// @return 新たに登録したオブジェクト数
+    size_t receive(const NodeAddress &address, const EchonetLiteFrameView &frame, const uint32_t now) {
+        if (registry.receive(address, frame, now) < 0) {
+            return 0;
+        }
+        size_t added = 0;
+        if (isNodeProfile(frame.EDATA.SEOJ) && isInstanceListService(frame.EDATA.echonetLiteService)) {
+            for (const EchonetLite::EchonetLitePropertyView property : frame) {
+                if (property.echonetLiteProperty == static_cast<uint8_t>(Property::SelfNodeInstanceListS) ||
+                    property.echonetLiteProperty == static_cast<uint8_t>(Property::InstanceListNotification)) {
+                    added += addInstances(address, property.payload, property.propertyDataCounter);
+                }
+            }
+        }
+        // 応答を受けた要求は完了とする
+        const size_t index = registry.add(address, frame.EDATA.SEOJ);
+        for (Probe &probe : probes) {
+            if (probe.index == index && registry[index].hasPropertyMap) {
+                probe.done = true;
+            }
+        }
+        return added;
+    }
+
+    /// @brief プロパティマップ要求の送信・再送
+    /// @return 送信したフレーム数
+    size_t poll(const uint32_t now, const Sender &sender) {
+        if (searching && static_cast<int32_t>(now - windowEnd) >= 0) {
+            searching = false;
+        }
+        size_t inFlight = 0;
+        for (Probe &probe : probes) {
+            if (probe.done || !probe.sent) {
+                continue;
+            }
+            if (now - probe.sentAt < requestTimeout) {
+                inFlight++;
+            } else if (probe.attempts > maxRetries) {
+                probe.done = true;
+            } else {
+                probe.sent = false;
+            }
+        }
+
+        size_t frames = 0;
+        for (Probe &probe : probes) {
+            if (inFlight >= maxInFlight) {
+                break;
+            }
+            if (probe.done || probe.sent) {
+                continue;
+            }
+            Request request;
+            request.nextTransactionId = registry.nextTransactionId;
+            const uint8_t props[]     = {
+                static_cast<uint8_t>(EchonetLite::Property::StatusChangeAnnouncementPropertyMap),
+                static_cast<uint8_t>(EchonetLite::Property::SetPropertyMap),
+                static_cast<uint8_t>(EchonetLite::Property::GetPropertyMap),
+            };
+            request.generateGetRequest(props, std::size(props));
+            request.data.EDATA.DEOJ    = registry[probe.index].object;
+            registry.nextTransactionId = request.nextTransactionId;
+
+            uint8_t frame[Request::maxFrameBytes];
+            if (!sender(registry.address(probe.index), frame, request.serializeTo(frame, sizeof(frame)))) {
+                break;
+            }
+            probe.sent   = true;
+            probe.sentAt = now;
+            probe.attempts++;
+            inFlight++;
+            frames++;
+        }
+        probes.erase(std::remove_if(probes.begin(), probes.end(), [](const Probe &probe) { return probe.done; }), probes.end());
+        return frames;
+    }
+
+    /// @brief 応答待ち時間が過ぎ、全てのプロパティマップ要求が完了したか
+    bool isComplete() const {
+        return !searching && probes.empty();
+    }
+
+    /// @brief 探索要求への応答待ち中か
+    bool isSearching() const {
+        return searching;
+    }
+
+  private:
+    struct Probe {
+        size_t index;
+        bool sent;
+        bool done;
+        uint8_t attempts;
+        uint32_t sentAt;
+    };
+
+    EchonetLiteNodeRegistry &registry;
+    std::vector<Probe> probes;
+    uint32_t windowEnd = 0;
+    bool searching     = false;
+
+    static bool isNodeProfile(const EchonetLiteObject &object) {
+        return object.classGroupCode == EchonetLite::ClassGroupCode::ProfileClassGroup && object.classCode == static_cast<uint8_t>(EchonetLite::ClassCode::NodeProfile);
+    }
+
+    static bool isInstanceListService(const EchonetLiteService service) {
+        return service == EchonetLiteService::Get_Res || service == EchonetLiteService::Get_SNA || service == EchonetLiteService::INF || service == EchonetLiteService::INFC;
+    }
+
+    /// @brief インスタンスリスト（インスタンス数 + EOJ×n）の登録
+    /// @note プロパティマップ取得済み・取得予約済みのオブジェクトは予約しない
+    size_t addInstances(const NodeAddress &address, const uint8_t *list, const size_t length) {
+        if (length == 0) {
+            return 0;
+        }
+        const size_t count = std::min<size_t>(list[0], (length - 1) / 3);
+        size_t added       = 0;
+        for (size_t i = 0; i < count; i++) {
+            const uint8_t *const eoj       = list + 1 + i * 3;
+            const EchonetLiteObject object = {static_cast<EchonetLite::ClassGroupCode>(eoj[0]), eoj[1], eoj[2]};
+            const size_t index             = registry.add(address, object);
+            if (registry[index].hasPropertyMap || std::any_of(probes.begin(), probes.end(), [index](const Probe &probe) { return probe.index == index; })) {
+                continue;
+            }
+            probes.push_back({index, false, false, 0, 0});
+            added++;
+        }
+        return added;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+#include <atomic>
+
+/// @brief 受信タスクとデコードタスク間の単一生産者・単一消費者フレームリング
+/// @details 生産者はスロットに直接書き込み（hex文字列はスロットへデコード）、消費者はスロットを参照したまま
+///          EchonetLiteFrameViewとして解析する。ロック・ヒープ確保を行わない
+/// @tparam Slots スロット数（2のべき乗）
+/// @tparam MaxFrameBytes 1スロットに格納できるフレーム長の上限
+/// @note 生産者・消費者はそれぞれ1つのタスク（またはISR）に限る
+template <size_t Slots, size_t MaxFrameBytes = 256>
+class EchonetLiteFrameRing {
+    static_assert(Slots >= 2 && (Slots & (Slots - 1)) == 0, "slot count must be a power of two");
+
+  public:
+    using EchonetLiteFrameView = EchonetLite::EchonetLiteFrameView;
+
+    static constexpr size_t maxFrameBytes = MaxFrameBytes;
+
+    /// @brief 書き込み先スロットの取得（生産者）
+    /// @return 満杯の場合はnullptr（破棄数に数える）
+    uint8_t *beginWrite() {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        if (head - tail.load(std::memory_order_acquire) == Slots) {
+            droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return slots[head & (Slots - 1)].bytes.data();
+    }
+
+    /// @brief beginWrite()で書き込んだフレームの公開（生産者）
+    void commit(const size_t length) {
+        const size_t head                = this->head.load(std::memory_order_relaxed);
+        slots[head & (Slots - 1)].length = length;
+        this->head.store(head + 1, std::memory_order_release);
+    }
+
+    /// @brief バイナリフレームの追加（生産者）
+    /// @return 満杯・フレームが長すぎる場合はfalse
+    bool push(const uint8_t *frame, const size_t length) {
+        if (length > MaxFrameBytes) {
+            droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint8_t *const slot = beginWrite();
+        if (slot == nullptr) {
+            return false;
+        }
+        memcpy(slot, frame, length);
+        commit(length);
+        return true;
+    }
+
+    /// @brief hex文字列のフレームをスロットへ直接デコードして追加（生産者）
+    /// @note 末尾の改行等（16進文字以外）は無視する
+    /// @return 満杯・不正なhex・フレームが長すぎる場合はfalse
+    bool pushHex(const char *hex, size_t length) {
+        length = EchonetLite::trimHexLength(hex, length);
+        if (length / 2 > MaxFrameBytes) {
+            droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint8_t *const slot = beginWrite();
+        if (slot == nullptr) {
+            return false;
+        }
+        const size_t decoded = EchonetLite::decodeHex(hex, length, slot, MaxFrameBytes);
+        if (decoded == 0) {
+            droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        commit(decoded);
+        return true;
+    }
+
+    /// @brief 先頭フレームの参照（消費者）
+    /// @note 戻り値はpop()まで有効。空の場合は無効なビュー
+    EchonetLiteFrameView front() const {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == tail) {
+            return EchonetLiteFrameView();
+        }
+        const Slot &slot = slots[tail & (Slots - 1)];
+        return EchonetLite::load(slot.bytes.data(), slot.length);
+    }
+
+    /// @brief 先頭フレームの生バイト列参照（消費者）
+    /// @return 空の場合はnullptr
+    const uint8_t *frontBytes(size_t *const length) const {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == tail) {
+            return nullptr;
+        }
+        const Slot &slot = slots[tail & (Slots - 1)];
+        *length          = slot.length;
+        return slot.bytes.data();
+    }
+
+    /// @brief 先頭フレームの解放（消費者）
+    /// @return 空の場合はfalse
+    bool pop() {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        this->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief 格納中のフレーム数（どちらのタスクからも参照可、参照時点の近似値）
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /// @brief 満杯・不正により破棄したフレーム数
+    uint32_t dropped() const {
+        return droppedFrames.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Slot {
+        size_t length;
+        std::array<uint8_t, MaxFrameBytes> bytes;
+    };
+
+    // 生産者・消費者の位置と破棄数は別のキャッシュラインに置く（破棄数は生産者のみが更新する）
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    alignas(64) std::atomic<uint32_t> droppedFrames{0};
+    alignas(64) std::array<Slot, Slots> slots;
+};
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/// @brief 受信・デコード処理の計測値
+/// @details ECHONETLITE_ENABLE_METRICSを定義した場合のみ記録する。未定義の場合は記録関数が空になり、
+///          計測領域も確保しない
+/// @note 記録はstd::atomicの加算のみで行うため、割り込み・別スレッドからsnapshot()を呼んでもよい
+class EchonetLiteMetrics {
+  public:
+#if defined(ECHONETLITE_ENABLE_METRICS)
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    /// @brief 応答時間を記録するDEOJ数（超えたDEOJはlatencyOverflowに数える）
+    static constexpr size_t maxLatencyObjects = 8;
+    /// @brief 応答時間ヒストグラムの区間数（区間0は0ms、区間nは2^(n-1)ms以上2^n ms未満、最終区間は上限なし）
+    static constexpr size_t latencyBuckets = 16;
+
+    /// @brief DEOJごとの応答時間ヒストグラム
+    struct Latency {
+        uint32_t object; ///< DEOJ（上位からクラスグループ・クラス・インスタンス）
+        std::array<uint32_t, latencyBuckets> buckets;
+    };
+
+    /// @brief 計測値の複製
+    struct Snapshot {
+        uint32_t framesParsed;                   ///< 解析したフレーム数
+        uint32_t framesMalformed;                ///< ヘッダ長に満たないフレーム数
+        uint32_t framesTruncated;                ///< OPC分のプロパティを含まないフレーム数
+        uint32_t transactionIdMismatches;        ///< 期待と異なるTIDの応答数
+        uint32_t unmatchedResponses;             ///< 応答待ち要求に対応しなかった受信フレーム数
+        uint32_t latencyOverflow;                ///< 記録先がなく捨てた応答時間の数
+        std::array<uint32_t, 256> decodedValues; ///< EPCごとの型付き取得の成功回数（取得関数の呼び出しごと）
+        std::array<uint32_t, 256> invalidValues; ///< EPCごとの型付き取得で無効値（0xFF..等）だった回数
+        size_t latencyCount;                     ///< latenciesの有効数
+        std::array<Latency, maxLatencyObjects> latencies;
+    };
+
+    /// @brief フレーム解析結果の記録
+    static void countFrame(const bool valid, const bool truncated) {
+        if constexpr (enabled) {
+            increment(valid ? counters().framesParsed : counters().framesMalformed);
+            if (truncated) {
+                increment(counters().framesTruncated);
+            }
+        }
+    }
+
+    /// @brief TID不一致の記録
+    static void countTransactionIdMismatch() {
+        if constexpr (enabled) {
+            increment(counters().transactionIdMismatches);
+        }
+    }
+
+    /// @brief 応答待ち要求に対応しない受信の記録
+    static void countUnmatchedResponse() {
+        if constexpr (enabled) {
+            increment(counters().unmatchedResponses);
+        }
+    }
+
+    /// @brief プロパティ値デコード結果の記録
+    /// @note 型付きの取得関数（get<>()・getSpecifiedPropertyData()等）が呼び出しごとに記録する。
+    ///       同じフレームの同じEPCを複数回取得した場合はその回数分数える（フレームあたりのプロパティ数ではない）
+    static void countDecode(const uint8_t prop, const bool valid) {
+        if constexpr (enabled) {
+            increment(valid ? counters().decodedValues[prop] : counters().invalidValues[prop]);
+        }
+    }
+
+    /// @brief 要求から応答までの時間の記録
+    /// @param object DEOJ（上位からクラスグループ・クラス・インスタンス）
+    static void recordLatency(const uint32_t object, const uint32_t elapsed) {
+        if constexpr (enabled) {
+            size_t bucket = 0;
+            for (uint32_t value = elapsed; value != 0 && bucket + 1 < latencyBuckets; value >>= 1) {
+                bucket++;
+            }
+            // 0は未使用を表すためDEOJ+1を格納する
+            const uint32_t key = object + 1;
+            for (LatencySlot &slot : counters().latencies) {
+                uint32_t current = slot.object.load(std::memory_order_relaxed);
+                if (current == 0 && slot.object.compare_exchange_strong(current, key, std::memory_order_relaxed)) {
+                    current = key;
+                }
+                if (current == key) {
+                    increment(slot.buckets[bucket]);
+                    return;
+                }
+            }
+            increment(counters().latencyOverflow);
+        }
+    }
+
+    /// @brief 計測値の取得
+    /// @note 各値は個別に読み出すため、記録中の値同士は厳密には同時点のものではない
+    static Snapshot snapshot() {
+        Snapshot result = {};
+        if constexpr (enabled) {
+            Counters &source               = counters();
+            result.framesParsed            = source.framesParsed.load(std::memory_order_relaxed);
+            result.framesMalformed         = source.framesMalformed.load(std::memory_order_relaxed);
+            result.framesTruncated         = source.framesTruncated.load(std::memory_order_relaxed);
+            result.transactionIdMismatches = source.transactionIdMismatches.load(std::memory_order_relaxed);
+            result.unmatchedResponses      = source.unmatchedResponses.load(std::memory_order_relaxed);
+            result.latencyOverflow         = source.latencyOverflow.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < 256; i++) {
+                result.decodedValues[i] = source.decodedValues[i].load(std::memory_order_relaxed);
+                result.invalidValues[i] = source.invalidValues[i].load(std::memory_order_relaxed);
+            }
+            for (const LatencySlot &slot : source.latencies) {
+                const uint32_t key = slot.object.load(std::memory_order_relaxed);
+                if (key == 0) {
+                    continue;
+                }
+                Latency &latency = result.latencies[result.latencyCount++];
+                latency.object   = key - 1;
+                for (size_t i = 0; i < latencyBuckets; i++) {
+                    latency.buckets[i] = slot.buckets[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        return result;
+    }
+
+    /// @brief 計測値の初期化
+    static void reset() {
+        if constexpr (enabled) {
+            Counters &target = counters();
+            for (std::atomic<uint32_t> *counter : {&target.framesParsed, &target.framesMalformed, &target.framesTruncated, &target.transactionIdMismatches, &target.unmatchedResponses, &target.latencyOverflow}) {
+                counter->store(0, std::memory_order_relaxed);
+            }
+            for (size_t i = 0; i < 256; i++) {
+                target.decodedValues[i].store(0, std::memory_order_relaxed);
+                target.invalidValues[i].store(0, std::memory_order_relaxed);
+            }
+            for (LatencySlot &slot : target.latencies) {
+                for (std::atomic<uint32_t> &bucket : slot.buckets) {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+                slot.object.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    struct LatencySlot {
+        std::atomic<uint32_t> object;
+        std::array<std::atomic<uint32_t>, latencyBuckets> buckets;
+    };
+
+    struct Counters {
+        std::atomic<uint32_t> framesParsed;
+        std::atomic<uint32_t> framesMalformed;
+        std::atomic<uint32_t> framesTruncated;
+        std::atomic<uint32_t> transactionIdMismatches;
+        std::atomic<uint32_t> unmatchedResponses;
+        std::atomic<uint32_t> latencyOverflow;
+        std::array<std::atomic<uint32_t>, 256> decodedValues;
+        std::array<std::atomic<uint32_t>, 256> invalidValues;
+        std::array<LatencySlot, maxLatencyObjects> latencies;
+    };
+
+    /// @brief 計測領域（静的領域に置くため0で初期化される）
+    static Counters &counters() {
+        static Counters instance;
+        return instance;
+    }
+
+    static void increment(std::atomic<uint32_t> &counter) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,319 @@
+#pragma once
+
+#include "BasicEchonetLite.hpp"
+#include <functional>
+#include <queue>
+#include <unordered_map>
+
+/// @brief 多数ノード・多数インスタンスのオブジェクト登録簿と定期取得スケジューラ
+/// @details (ノードアドレス, EOJ)ごとにトランザクション状態・プロパティマップ・取得値を連続領域に保持し、
+///          定期取得の期限順にGet要求を生成する
+/// @note 時刻は呼び出し元のミリ秒カウンタで与える
+class EchonetLiteNodeRegistry {
+  public:
+    using EchonetLiteObject       = EchonetLite::EchonetLiteObject;
+    using EchonetLiteService      = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView    = EchonetLite::EchonetLiteFrameView;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+
+    /// @brief 1フレームで要求するEPC数の上限
+    static constexpr size_t maxPropsPerRequest = 16;
+    using Request                              = BasicEchonetLite<maxPropsPerRequest, EchonetLite::minimumFrameSize + maxPropsPerRequest * 2>;
+
+    /// @brief ノードアドレス（IPv6アドレス。IPv4はIPv4射影アドレス、MACは下位8バイトに格納する）
+    struct NodeAddress {
+        std::array<uint8_t, 16> bytes = {};
+
+        bool operator==(const NodeAddress &other) const {
+            return bytes == other.bytes;
+        }
+    };
+
+    /// @brief ノードアドレスのハッシュ（FNV-1a）
+    struct NodeAddressHash {
+        size_t operator()(const NodeAddress &address) const {
+            uint64_t hash = 14695981039346656037ULL;
+            for (const uint8_t byte : address.bytes) {
+                hash = (hash ^ byte) * 1099511628211ULL;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    /// @brief EPC集合（256bit）
+    struct PropertySet {
+        std::array<uint32_t, 8> bits = {};
+
+        void set(const uint8_t prop) {
+            bits[prop >> 5] |= 1UL << (prop & 0x1F);
+        }
+
+        bool test(const uint8_t prop) const {
+            return bits[prop >> 5] & (1UL << (prop & 0x1F));
+        }
+
+        bool empty() const {
+            return std::all_of(bits.begin(), bits.end(), [](const uint32_t word) { return word == 0; });
+        }
+    };
+
+    /// @brief オブジェクトごとの状態
+    struct ObjectState {
+        uint32_t node;                  ///< nodes内の位置
+        EchonetLiteObject object;       ///< EOJ
+        bool awaiting;                  ///< 応答待ち
+        uint16_t transactionId;         ///< 応答待ちTID
+        uint32_t requestedAt;           ///< 最終要求時刻
+        uint32_t respondedAt;           ///< 最終応答時刻
+        uint32_t pollInterval;          ///< 定期取得間隔（0で定期取得しない）
+        uint32_t misses;                ///< 連続無応答回数
+        uint32_t pollGeneration;        ///< 定期取得設定の世代（古い予定の破棄に使う）
+        uint8_t pollCursor;             ///< 次回の定期取得を始めるEPC
+        PropertySet pollProperties;     ///< 定期取得するEPC
+        PropertySet getProperties;      ///< Getプロパティマップ
+        PropertySet setProperties;      ///< Setプロパティマップ
+        PropertySet announceProperties; ///< 状変アナウンスプロパティマップ
+        bool hasPropertyMap;            ///< Getプロパティマップ取得済み
+    };
+
+    /// @brief 送信（ノードアドレス、フレーム）
+    using Sender = std::function<bool(const NodeAddress &address, const uint8_t *frame, size_t length)>;
+
+    uint16_t nextTransactionId = 0;
+
+    /// @brief 状変アナウンスプロパティマップに含まれるEPCを、値の取得後は定期取得しない
+    /// @note 以降の値はINF・INFCをreceive()に渡して更新する
+    bool suppressAnnounced = false;
+
+    /// @brief オブジェクトの登録（登録済みならその位置を返す）
+    size_t add(const NodeAddress &address, const EchonetLiteObject &object) {
+        const uint32_t node = findOrAddNode(address);
+        const uint64_t key  = makeKey(node, object);
+        const auto found    = objectIndex.find(key);
+        if (found != objectIndex.end()) {
+            return found->second;
+        }
+        ObjectState state = {};
+        state.node        = node;
+        state.object      = object;
+        objects.push_back(state);
+        objectIndex.emplace(key, objects.size() - 1);
+        return objects.size() - 1;
+    }
+
+    /// @brief オブジェクトの検索
+    /// @return 未登録の場合はnullptr
+    const ObjectState *find(const NodeAddress &address, const EchonetLiteObject &object) const {
+        const ptrdiff_t node = findNode(address);
+        if (node < 0) {
+            return nullptr;
+        }
+        const auto found = objectIndex.find(makeKey(node, object));
+        return found == objectIndex.end() ? nullptr : &objects[found->second];
+    }
+
+    size_t size() const {
+        return objects.size();
+    }
+
+    const ObjectState &operator[](const size_t index) const {
+        return objects[index];
+    }
+
+    const NodeAddress &address(const size_t index) const {
+        return nodes[objects[index].node];
+    }
+
+    /// @brief 定期取得の設定
+    /// @note 再設定した場合、以前の設定による予定は破棄する
+    void setPolling(const size_t index, const uint8_t *props, const size_t count, const uint32_t interval, const uint32_t now) {
+        ObjectState &state   = objects[index];
+        state.pollProperties = PropertySet();
+        for (size_t i = 0; i < count; i++) {
+            state.pollProperties.set(props[i]);
+        }
+        state.pollInterval = interval;
+        state.pollCursor   = 0;
+        state.pollGeneration++;
+        schedule.push({now, static_cast<uint32_t>(index), state.pollGeneration});
+    }
+
+    /// @brief 取得値の参照
+    /// @note 値は次回の同一EPC更新まで有効
+    bool getValue(const size_t index, const uint8_t prop, EchonetLitePropertyView *const out, uint32_t *const updatedAt = nullptr) const {
+        const auto found = values.find(makeValueKey(index, prop));
+        if (found == values.end()) {
+            return false;
+        }
+        out->echonetLiteProperty = prop;
+        out->propertyDataCounter = found->second.length;
+        out->payload             = valueArena.data() + found->second.offset;
+        if (updatedAt != nullptr) {
+            *updatedAt = found->second.updatedAt;
+        }
+        return true;
+    }
+
+    /// @brief 期限を迎えたオブジェクトへのGet要求送信
+    /// @note 応答待ちのまま期限を迎えた場合は無応答として数え、再度要求する。
+    ///       定期取得するEPCが1フレームの上限を超える場合は、周期ごとに続きのEPCから要求する
+    /// @return 送信したフレーム数
+    size_t poll(const uint32_t now, const size_t maxFrames, const Sender &sender) {
+        size_t frames = 0;
+        while (!schedule.empty() && frames < maxFrames && static_cast<int32_t>(now - schedule.top().due) >= 0) {
+            const ScheduleEntry entry = schedule.top();
+            schedule.pop();
+            ObjectState &state = objects[entry.index];
+            if (state.pollInterval == 0 || entry.generation != state.pollGeneration) {
+                continue;
+            }
+            if (state.awaiting) {
+                state.misses++;
+            }
+            const uint32_t index = entry.index;
+            schedule.push({now + state.pollInterval, index, entry.generation});
+
+            uint8_t props[maxPropsPerRequest];
+            size_t count = 0;
+            for (size_t i = 0; i < 256 && count < maxPropsPerRequest; i++) {
+                const uint8_t prop = static_cast<uint8_t>(state.pollCursor + i);
+                // プロパティマップ取得済みならGet可能なEPCに絞る
+                if (!state.pollProperties.test(prop) || (state.hasPropertyMap && !state.getProperties.test(prop))) {
+                    continue;
+                }
+                if (suppressAnnounced && state.announceProperties.test(prop) && values.count(makeValueKey(index, prop)) != 0) {
+                    continue;
+                }
+                props[count++] = prop;
+            }
+            if (count == 0) {
+                continue;
+            }
+            if (count == maxPropsPerRequest) {
+                state.pollCursor = static_cast<uint8_t>(props[count - 1] + 1);
+            }
+            Request request;
+            request.nextTransactionId = nextTransactionId;
+            request.generateGetRequest(props, count);
+            request.data.EDATA.DEOJ = state.object;
+            nextTransactionId       = request.nextTransactionId;
+
+            uint8_t frame[Request::maxFrameBytes];
+            const size_t length = request.serializeTo(frame, sizeof(frame));
+            if (sender(nodes[state.node], frame, length)) {
+                state.awaiting      = true;
+                state.transactionId = request.data.EHEAD.TransactionId;
+                state.requestedAt   = now;
+                frames++;
+            }
+        }
+        return frames;
+    }
+
+    /// @brief 受信フレームの取り込み
+    /// @note 未登録の送信元オブジェクトは登録する。プロパティマップを含む場合は更新する
+    /// @return 取り込んだオブジェクトの位置（フレームが不正な場合は-1）
+    ptrdiff_t receive(const NodeAddress &address, const EchonetLiteFrameView &frame, const uint32_t now) {
+        if (!frame.valid) {
+            return -1;
+        }
+        const size_t index = add(address, frame.EDATA.SEOJ);
+        ObjectState &state = objects[index];
+        if (state.awaiting && state.transactionId == frame.EHEAD.TransactionId) {
+            state.awaiting = false;
+            state.misses   = 0;
+            EchonetLiteMetrics::recordLatency((static_cast<uint32_t>(state.object.classGroupCode) << 16) | (state.object.classCode << 8) | state.object.instanceCode, now - state.requestedAt);
+        }
+        state.respondedAt = now;
+        for (const EchonetLitePropertyView property : frame) {
+            if (property.propertyDataCounter == 0) {
+                continue;
+            }
+            switch (static_cast<EchonetLite::Property>(property.echonetLiteProperty)) {
+                case EchonetLite::Property::GetPropertyMap:
+                    state.hasPropertyMap = decodePropertyMap(property, &state.getProperties);
+                    break;
+                case EchonetLite::Property::SetPropertyMap:
+                    decodePropertyMap(property, &state.setProperties);
+                    break;
+                case EchonetLite::Property::StatusChangeAnnouncementPropertyMap:
+                    decodePropertyMap(property, &state.announceProperties);
+                    break;
+                default:
+                    break;
+            }
+            storeValue(index, property, now);
+        }
+        return index;
+    }
+
+  private:
+    struct ScheduleEntry {
+        uint32_t due;
+        uint32_t index;
+        uint32_t generation;
+
+        bool operator>(const ScheduleEntry &other) const {
+            return static_cast<int32_t>(due - other.due) > 0;
+        }
+    };
+
+    struct ValueSlot {
+        uint32_t offset;
+        uint8_t length;
+        uint8_t capacity;
+        uint32_t updatedAt;
+    };
+
+    std::vector<NodeAddress> nodes;
+    std::vector<ObjectState> objects;
+    std::unordered_map<NodeAddress, uint32_t, NodeAddressHash> nodeIndex;
+    std::unordered_map<uint64_t, size_t> objectIndex;
+    std::unordered_map<uint64_t, ValueSlot> values;
+    std::vector<uint8_t> valueArena;
+    std::priority_queue<ScheduleEntry, std::vector<ScheduleEntry>, std::greater<ScheduleEntry>> schedule;
+
+    /// @return 未登録の場合は-1
+    ptrdiff_t findNode(const NodeAddress &address) const {
+        const auto found = nodeIndex.find(address);
+        return found == nodeIndex.end() ? -1 : static_cast<ptrdiff_t>(found->second);
+    }
+
+    uint32_t findOrAddNode(const NodeAddress &address) {
+        const auto inserted = nodeIndex.emplace(address, static_cast<uint32_t>(nodes.size()));
+        if (inserted.second) {
+            nodes.push_back(address);
+        }
+        return inserted.first->second;
+    }
+
+    static uint64_t makeKey(const uint32_t node, const EchonetLiteObject &object) {
+        return (static_cast<uint64_t>(node) << 24) | (static_cast<uint32_t>(object.classGroupCode) << 16) | (object.classCode << 8) | object.instanceCode;
+    }
+
+    static uint64_t makeValueKey(const size_t index, const uint8_t prop) {
+        return (static_cast<uint64_t>(index) << 8) | prop;
+    }
+
+    static bool decodePropertyMap(const EchonetLitePropertyView &property, PropertySet *const out) {
+        PropertySet props;
+        if (!EchonetLite::forEachPropertyMapEntry(property.payload, property.propertyDataCounter, [&props](const uint8_t prop) { props.set(prop); })) {
+            return false;
+        }
+        *out = props;
+        return true;
+    }
+
+    /// @brief 取得値の格納（同じ長さ以下なら領域を再利用する）
+    void storeValue(const size_t index, const EchonetLitePropertyView &property, const uint32_t now) {
+        ValueSlot &slot = values[makeValueKey(index, property.echonetLiteProperty)];
+        if (slot.capacity < property.propertyDataCounter) {
+            slot.offset   = valueArena.size();
+            slot.capacity = property.propertyDataCounter;
+            valueArena.resize(valueArena.size() + property.propertyDataCounter);
+        }
+        memcpy(valueArena.data() + slot.offset, property.payload, property.propertyDataCounter);
+        slot.length    = property.propertyDataCounter;
+        slot.updatedAt = now;
+    }
+};
\ No newline at end of file
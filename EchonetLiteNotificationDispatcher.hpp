@@ -0,0 +1,135 @@
+#pragma once
+
+#include "EchonetLiteNodeRegistry.hpp"
+#include <functional>
+
+/// @brief プロパティ値通知（INF・INFC）の購読と振り分け
+/// @details (EOJ, EPC)ごとに登録したコールバックへ通知されたプロパティを渡し、INFCにはINFC_Resを返す
+/// @tparam MaxSubscriptions 登録できる購読数
+/// @tparam Address 送信元アドレスの型（UDPトランスポートと組み合わせる場合はsockaddr_in）
+/// @note インスタンスコード0x00で登録した購読は同じクラスの全インスタンスの通知を受ける
+template <size_t MaxSubscriptions = 16, class Address = EchonetLiteNodeRegistry::NodeAddress>
+class EchonetLiteNotificationDispatcher {
+  public:
+    using EchonetLiteObject       = EchonetLite::EchonetLiteObject;
+    using EchonetLiteService      = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView    = EchonetLite::EchonetLiteFrameView;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+
+    /// @brief 通知（送信元オブジェクト、通知されたプロパティ）
+    /// @note propertyの参照先は通知の間だけ有効
+    using Callback = std::function<void(const EchonetLiteObject &source, const EchonetLitePropertyView &property)>;
+
+    /// @brief フレーム送信（宛先アドレス、送信できた場合true）
+    using Sender = std::function<bool(const Address &address, const uint8_t *frame, size_t length)>;
+
+    explicit EchonetLiteNotificationDispatcher(Sender sender) : sender(std::move(sender)) {}
+
+    /// @brief 購読の登録
+    /// @return 登録数の上限を超えた場合はfalse
+    bool subscribe(const EchonetLiteObject &object, const uint8_t prop, Callback callback) {
+        for (Subscription &subscription : subscriptions) {
+            if (!subscription.active) {
+                subscription.active   = true;
+                subscription.object   = object;
+                subscription.property = prop;
+                subscription.callback = std::move(callback);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <class PropertyType, typename std::enable_if_t<std::is_enum_v<PropertyType>, int> = 0>
+    bool subscribe(const EchonetLiteObject &object, const PropertyType prop, Callback callback) {
+        return subscribe(object, static_cast<uint8_t>(prop), std::move(callback));
+    }
+
+    /// @brief 購読の解除
+    /// @return 解除した購読数
+    size_t unsubscribe(const EchonetLiteObject &object, const uint8_t prop) {
+        size_t removed = 0;
+        for (Subscription &subscription : subscriptions) {
+            if (subscription.active && subscription.property == prop && isSameObject(subscription.object, object)) {
+                subscription.active   = false;
+                subscription.callback = nullptr;
+                removed++;
+            }
+        }
+        return removed;
+    }
+
+    /// @brief 購読しているか
+    bool isSubscribed(const EchonetLiteObject &object, const uint8_t prop) const {
+        return std::any_of(subscriptions.begin(), subscriptions.end(), [&object, prop](const Subscription &subscription) {
+            return subscription.active && subscription.property == prop && matches(subscription.object, object);
+        });
+    }
+
+    /// @brief 受信フレームの振り分け
+    /// @details INF・INFCのプロパティを購読者へ渡す。INFCには購読の有無にかかわらず送信元へINFC_Resを返す
+    /// @param from 送信元アドレス
+    /// @return 呼び出したコールバック数（INF・INFC以外のフレームは0）
+    /// @note コールバック内で購読の登録・解除を行ってもよい
+    size_t dispatch(const Address &from, const EchonetLiteFrameView &frame) {
+        if (!frame.valid || (frame.EDATA.echonetLiteService != EchonetLiteService::INF && frame.EDATA.echonetLiteService != EchonetLiteService::INFC)) {
+            return 0;
+        }
+        size_t called = 0;
+        for (const EchonetLitePropertyView property : frame) {
+            for (Subscription &subscription : subscriptions) {
+                if (subscription.active && subscription.property == property.echonetLiteProperty && matches(subscription.object, frame.EDATA.SEOJ)) {
+                    // コールバック内の解除・再登録で呼び出し中の関数オブジェクトが破棄されないよう複製して呼び出す
+                    const Callback callback = subscription.callback;
+                    callback(frame.EDATA.SEOJ, property);
+                    called++;
+                }
+            }
+        }
+        if (frame.EDATA.echonetLiteService == EchonetLiteService::INFC) {
+            respond(from, frame);
+        }
+        return called;
+    }
+
+    /// @brief 受信フレームの振り分け（バイナリ）
+    size_t dispatch(const Address &from, const uint8_t *buf, const size_t len) {
+        return dispatch(from, EchonetLite::load(buf, len));
+    }
+
+  private:
+    struct Subscription {
+        bool active = false;
+        EchonetLiteObject object;
+        uint8_t property;
+        Callback callback;
+    };
+
+    Sender sender;
+    std::array<Subscription, MaxSubscriptions> subscriptions;
+
+    static bool isSameObject(const EchonetLiteObject &a, const EchonetLiteObject &b) {
+        return a.classGroupCode == b.classGroupCode && a.classCode == b.classCode && a.instanceCode == b.instanceCode;
+    }
+
+    /// @brief 購読対象のオブジェクトか（インスタンスコード0x00は全インスタンス）
+    static bool matches(const EchonetLiteObject &subscribed, const EchonetLiteObject &source) {
+        return subscribed.classGroupCode == source.classGroupCode && subscribed.classCode == source.classCode && (subscribed.instanceCode == 0x00 || subscribed.instanceCode == source.instanceCode);
+    }
+
+    /// @brief 送信元へのINFC_Resの送信（受信したEPCをPDC=0で返す）
+    void respond(const Address &to, const EchonetLiteFrameView &frame) {
+        std::array<uint8_t, EchonetLite::minimumFrameSize + std::numeric_limits<uint8_t>::max() * 2> response;
+        EchonetLite::EchonetLiteData edata = frame.EDATA;
+        edata.SEOJ                         = frame.EDATA.DEOJ;
+        edata.DEOJ                         = frame.EDATA.SEOJ;
+        edata.echonetLiteService           = EchonetLiteService::INFC_Res;
+        edata.operationPropertyCounter     = frame.propertyCount;
+        size_t length                      = EchonetLite::serializeHeader(frame.EHEAD, edata, response.data());
+        for (const EchonetLitePropertyView property : frame) {
+            response[length++] = property.echonetLiteProperty;
+            response[length++] = 0;
+        }
+        sender(to, response.data(), length);
+    }
+};
\ No newline at end of file
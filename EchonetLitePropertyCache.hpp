@@ -0,0 +1,317 @@
+#pragma once
+
+#include "LowVoltageSmartElectricEnergyMeter.hpp"
+
+/// @brief (EOJ, EPC)単位のプロパティ値キャッシュ
+/// @details EPCごとに有効期間（TTL）を設定し、期間内の値はネットワークに問い合わせずに返す。
+///          TTLは全クラス共通、またはクラス（クラスグループコード・クラスコード）ごとに設定でき、クラスごとの設定を優先する。
+///          INF・INFCで通知された値は受信時に置き換える
+/// @tparam MaxEntries 保持できるプロパティ数
+/// @tparam MaxValueBytes 1プロパティあたりのEDT長の上限（超えるものはキャッシュしない）
+/// @tparam MaxRules EPCごとのTTL設定数
+/// @note 時刻は呼び出し元のミリ秒カウンタ（millis()等）で与える
+template <size_t MaxEntries, size_t MaxValueBytes = 32, size_t MaxRules = 16>
+class EchonetLitePropertyCache {
+  public:
+    using EchonetLiteObject       = EchonetLite::EchonetLiteObject;
+    using EchonetLiteService      = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView    = EchonetLite::EchonetLiteFrameView;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+
+    static constexpr uint32_t staticPropertyTtl = 24UL * 60 * 60 * 1000; ///< ほぼ変化しないプロパティの既定TTL[ms]
+
+    /// @brief クラス固有のプロパティ（インスタンスコードは問わない）
+    struct ClassProperty {
+        EchonetLiteObject object;
+        uint8_t property;
+    };
+
+    /// @brief 値がほぼ変化しない機器オブジェクトスーパークラスのプロパティ（全クラス共通）
+    static constexpr uint8_t superclassStaticProperties[] = {
+        static_cast<uint8_t>(EchonetLite::Property::StandardVersionInformation),
+        static_cast<uint8_t>(EchonetLite::Property::ManufacturerCode),
+        static_cast<uint8_t>(EchonetLite::Property::StatusChangeAnnouncementPropertyMap),
+        static_cast<uint8_t>(EchonetLite::Property::SetPropertyMap),
+        static_cast<uint8_t>(EchonetLite::Property::GetPropertyMap),
+    };
+
+    /// @brief 値がほぼ変化しないクラス固有のプロパティ
+    static constexpr ClassProperty classStaticProperties[] = {
+        {LowVoltageSmartElectricEnergyMeterClass::eoj(), static_cast<uint8_t>(LowVoltageSmartElectricEnergyMeterClass::Property::BRouteIdentificationNumber)},
+        {LowVoltageSmartElectricEnergyMeterClass::eoj(), static_cast<uint8_t>(LowVoltageSmartElectricEnergyMeterClass::Property::Coefficient)},
+        {LowVoltageSmartElectricEnergyMeterClass::eoj(), static_cast<uint8_t>(LowVoltageSmartElectricEnergyMeterClass::Property::CumulativeAmountEnergyEffectiveDigits)},
+        {LowVoltageSmartElectricEnergyMeterClass::eoj(), static_cast<uint8_t>(LowVoltageSmartElectricEnergyMeterClass::Property::CumulativeEnergyUnit)},
+    };
+
+    /// @brief 値がほぼ変化しないプロパティにTTLを設定して初期化
+    explicit EchonetLitePropertyCache() {
+        setTtl(superclassStaticProperties, std::size(superclassStaticProperties), staticPropertyTtl);
+        for (const ClassProperty &property : classStaticProperties) {
+            setTtl(property.object, property.property, staticPropertyTtl);
+        }
+    }
+
+    /// @brief EPCのTTL設定（全クラス共通、0でキャッシュしない）
+    /// @return 設定数の上限を超えた場合はfalse
+    bool setTtl(const uint8_t prop, const uint32_t ttl) {
+        return setRule(true, EchonetLiteObject(), prop, ttl);
+    }
+
+    /// @brief クラス固有のEPCのTTL設定（インスタンスコードは問わない、0でキャッシュしない）
+    /// @return 設定数の上限を超えた場合はfalse
+    bool setTtl(const EchonetLiteObject &object, const uint8_t prop, const uint32_t ttl) {
+        return setRule(false, object, prop, ttl);
+    }
+
+    /// @brief 複数EPCのTTL設定
+    bool setTtl(const uint8_t *props, const size_t count, const uint32_t ttl) {
+        bool result = true;
+        for (size_t i = 0; i < count; i++) {
+            result &= setTtl(props[i], ttl);
+        }
+        return result;
+    }
+
+    template <class PropertyType, typename std::enable_if_t<std::is_enum_v<PropertyType>, int> = 0>
+    bool setTtl(const PropertyType prop, const uint32_t ttl) {
+        return setTtl(static_cast<uint8_t>(prop), ttl);
+    }
+
+    /// @brief EPCのTTL取得（全クラス共通の設定）
+    uint32_t getTtl(const uint8_t prop) const {
+        const Rule *const rule = findRule(true, EchonetLiteObject(), prop);
+        return rule == nullptr ? 0 : rule->ttl;
+    }
+
+    /// @brief オブジェクトのEPCのTTL取得（クラス固有の設定を優先する）
+    uint32_t getTtl(const EchonetLiteObject &object, const uint8_t prop) const {
+        const Rule *rule = findRule(false, object, prop);
+        if (rule == nullptr) {
+            rule = findRule(true, object, prop);
+        }
+        return rule == nullptr ? 0 : rule->ttl;
+    }
+
+    /// @brief 受信フレームのプロパティ値を格納
+    /// @note Get_Res・Get_SNA・SetGet_Res・INF・INFC以外のフレームおよび値のないプロパティは無視する
+    /// @return 格納したプロパティ数
+    size_t store(const EchonetLiteFrameView &frame, const uint32_t now) {
+        if (!frame.valid) {
+            return 0;
+        }
+        switch (frame.EDATA.echonetLiteService) {
+            case EchonetLiteService::Get_Res:
+            case EchonetLiteService::SetGet_Res:
+            case EchonetLiteService::INF:
+            case EchonetLiteService::INFC:
+            case EchonetLiteService::Get_SNA:
+                break;
+            default:
+                return 0;
+        }
+        const bool announcement = frame.EDATA.echonetLiteService == EchonetLiteService::INF || frame.EDATA.echonetLiteService == EchonetLiteService::INFC;
+        size_t stored           = 0;
+        for (const EchonetLitePropertyView property : frame) {
+            if (property.propertyDataCounter == 0) {
+                continue;
+            }
+            if (announcement) {
+                // 状変通知された値は古い値を破棄してから格納する
+                invalidate(frame.EDATA.SEOJ, property.echonetLiteProperty);
+            }
+            stored += store(frame.EDATA.SEOJ, property, now);
+        }
+        return stored;
+    }
+
+    /// @brief プロパティ値を格納
+    /// @return TTL未設定・値が長すぎる場合は0
+    size_t store(const EchonetLiteObject &object, const EchonetLitePropertyView &property, const uint32_t now) {
+        const uint32_t ttl = getTtl(object, property.echonetLiteProperty);
+        if (ttl == 0 || property.propertyDataCounter > MaxValueBytes) {
+            return 0;
+        }
+        Entry *const entry = findSlot(object, property.echonetLiteProperty, now);
+        entry->valid       = true;
+        entry->object      = object;
+        entry->property    = property.echonetLiteProperty;
+        entry->length      = property.propertyDataCounter;
+        entry->storedAt    = now;
+        entry->ttl         = ttl;
+        memcpy(entry->value.data(), property.payload, property.propertyDataCounter);
+        return 1;
+    }
+
+    /// @brief 有効期間内のプロパティ値を取得
+    /// @note outはキャッシュ内を参照する
+    bool find(const EchonetLiteObject &object, const uint8_t prop, const uint32_t now, EchonetLitePropertyView *const out) const {
+        const Entry *const entry = findEntry(object, prop);
+        if (entry == nullptr || !entry->isFresh(now)) {
+            return false;
+        }
+        out->echonetLiteProperty = entry->property;
+        out->propertyDataCounter = entry->length;
+        out->payload             = entry->value.data();
+        return true;
+    }
+
+    /// @brief 有効期間内のプロパティ値をプロパティ定義に従って取得
+    template <class Schema>
+    bool get(const EchonetLiteObject &object, const uint8_t prop, const uint32_t now, typename Schema::value_type *const out) const {
+        EchonetLitePropertyView property;
+        if (!find(object, prop, now, &property) || property.propertyDataCounter != Schema::size) {
+            return false;
+        }
+        return EchonetLite::decodeProperty<Schema>(property.payload, out);
+    }
+
+    /// @brief 要求EPCのうちキャッシュが無効なものを抽出
+    /// @return staleへ格納したEPC数
+    size_t collectStale(const EchonetLiteObject &object, const uint8_t *props, const size_t count, const uint32_t now, uint8_t *const stale) const {
+        size_t staleCount = 0;
+        for (size_t i = 0; i < count; i++) {
+            const Entry *const entry = findEntry(object, props[i]);
+            if (entry == nullptr || !entry->isFresh(now)) {
+                stale[staleCount++] = props[i];
+            }
+        }
+        return staleCount;
+    }
+
+    /// @brief キャッシュが無効なEPCだけのGet要求を生成
+    /// @return 要求が不要（全て有効）、EPCが1フレームの上限（255）を超える、または生成できなかった場合はfalse
+    template <class Packet>
+    bool generateGetRequest(Packet &request, const EchonetLiteObject &object, const uint8_t *props, const size_t count, const uint32_t now) const {
+        uint8_t stale[std::numeric_limits<uint8_t>::max()];
+        if (count > sizeof(stale)) {
+            return false;
+        }
+        const size_t staleCount = collectStale(object, props, count, now, stale);
+        if (staleCount == 0) {
+            return false;
+        }
+        // EchonetLiteのgenerateGetRequestは失敗しないためvoidを返す
+        if constexpr (std::is_void_v<decltype(request.generateGetRequest(stale, staleCount))>) {
+            request.generateGetRequest(stale, staleCount);
+        } else if (!request.generateGetRequest(stale, staleCount)) {
+            return false;
+        }
+        request.data.EDATA.DEOJ = object;
+        return true;
+    }
+
+    /// @brief 指定プロパティの無効化
+    void invalidate(const EchonetLiteObject &object, const uint8_t prop) {
+        Entry *const entry = findEntry(object, prop);
+        if (entry != nullptr) {
+            entry->valid = false;
+        }
+    }
+
+    /// @brief 指定オブジェクトの全プロパティの無効化
+    void invalidate(const EchonetLiteObject &object) {
+        for (Entry &entry : entries) {
+            if (entry.valid && isSameObject(entry.object, object)) {
+                entry.valid = false;
+            }
+        }
+    }
+
+    /// @brief 全プロパティの無効化
+    void clear() {
+        for (Entry &entry : entries) {
+            entry.valid = false;
+        }
+    }
+
+  private:
+    struct Rule {
+        bool allClasses = false;  ///< 全クラス共通の設定
+        EchonetLiteObject object; ///< 対象クラス（インスタンスコードは使わない）
+        uint8_t property = 0;     ///< EPC
+        uint32_t ttl     = 0;     ///< TTL[ms]（0は未使用）
+    };
+
+    struct Entry {
+        bool valid = false;
+        EchonetLiteObject object;
+        uint8_t property;
+        uint8_t length;
+        uint32_t storedAt;
+        uint32_t ttl;
+        std::array<uint8_t, MaxValueBytes> value;
+
+        bool isFresh(const uint32_t now) const {
+            return valid && now - storedAt < ttl;
+        }
+    };
+
+    std::array<Rule, MaxRules> rules;
+    std::array<Entry, MaxEntries> entries;
+
+    static bool isSameObject(const EchonetLiteObject &a, const EchonetLiteObject &b) {
+        return a.classGroupCode == b.classGroupCode && a.classCode == b.classCode && a.instanceCode == b.instanceCode;
+    }
+
+    static bool isSameClass(const EchonetLiteObject &a, const EchonetLiteObject &b) {
+        return a.classGroupCode == b.classGroupCode && a.classCode == b.classCode;
+    }
+
+    const Rule *findRule(const bool allClasses, const EchonetLiteObject &object, const uint8_t prop) const {
+        for (const Rule &rule : rules) {
+            if (rule.ttl != 0 && rule.property == prop && rule.allClasses == allClasses && (allClasses || isSameClass(rule.object, object))) {
+                return &rule;
+            }
+        }
+        return nullptr;
+    }
+
+    bool setRule(const bool allClasses, const EchonetLiteObject &object, const uint8_t prop, const uint32_t ttl) {
+        Rule *const existing = const_cast<Rule *>(findRule(allClasses, object, prop));
+        if (existing != nullptr) {
+            existing->ttl = ttl;
+            return true;
+        }
+        if (ttl == 0) {
+            return true;
+        }
+        for (Rule &rule : rules) {
+            if (rule.ttl == 0) {
+                rule = {allClasses, object, prop, ttl};
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Entry *findEntry(const EchonetLiteObject &object, const uint8_t prop) {
+        for (Entry &entry : entries) {
+            if (entry.valid && entry.property == prop && isSameObject(entry.object, object)) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    const Entry *findEntry(const EchonetLiteObject &object, const uint8_t prop) const {
+        return const_cast<EchonetLitePropertyCache *>(this)->findEntry(object, prop);
+    }
+
+    /// @brief 格納先の選択（同一キー→空き→期限切れ→最古の順）
+    Entry *findSlot(const EchonetLiteObject &object, const uint8_t prop, const uint32_t now) {
+        Entry *const existing = findEntry(object, prop);
+        if (existing != nullptr) {
+            return existing;
+        }
+        Entry *oldest = &entries[0];
+        for (Entry &entry : entries) {
+            if (!entry.valid || !entry.isFresh(now)) {
+                return &entry;
+            }
+            if (now - entry.storedAt > now - oldest->storedAt) {
+                oldest = &entry;
+            }
+        }
+        return oldest;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "BasicEchonetLite.hpp"
+#include <functional>
+
+/// @brief Get要求の集約スケジューラ
+/// @details 同一DEOJ宛の保留中Get要求を1フレームにまとめて送信し、応答をEPCごとに要求元へ振り分ける。
+///          1フレームに収まらないEPCは次のフレームに分割する
+/// @tparam TransactionManager 送信・応答照合に使用するEchonetLiteTransactionManager
+/// @tparam MaxPending 保留できる要求（EPC単位、応答待ちを含む）の上限
+/// @tparam MaxPropsPerFrame 1フレームに詰めるEPC数の上限
+template <class TransactionManager, size_t MaxPending = 32, size_t MaxPropsPerFrame = 16>
+class EchonetLiteRequestScheduler {
+  public:
+    using Status                  = typename TransactionManager::Status;
+    using EchonetLiteObject       = EchonetLite::EchonetLiteObject;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+    using Request                 = BasicEchonetLite<MaxPropsPerFrame, EchonetLite::minimumFrameSize + MaxPropsPerFrame * 2>;
+
+    /// @brief EPCごとの完了通知（応答に含まれなかった場合・Timeoutの場合propertyはnullptr）
+    using Callback = std::function<void(Status status, const EchonetLitePropertyView *property)>;
+
+    explicit EchonetLiteRequestScheduler(TransactionManager &transactionManager, const size_t maxPropertiesPerFrame = MaxPropsPerFrame)
+        : transactionManager(transactionManager) {
+        setMaxPropertiesPerFrame(maxPropertiesPerFrame);
+    }
+
+    /// @brief 1フレームに詰めるEPC数の変更（フレーム長・MTUの制約に合わせる）
+    void setMaxPropertiesPerFrame(const size_t count) {
+        maxPropertiesPerFrame = std::max<size_t>(1, std::min(count, MaxPropsPerFrame));
+    }
+
+    /// @brief Get要求の保留
+    /// @return 保留できる数（応答待ちを含む）を超えた場合はfalse
+    bool request(const EchonetLiteObject &destination, const uint8_t prop, Callback callback) {
+        for (Pending &pending : pendings) {
+            if (pending.state == State::Free) {
+                pending.state       = State::Queued;
+                pending.destination = destination;
+                pending.property    = prop;
+                pending.callback    = std::move(callback);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <class PropertyType, typename std::enable_if_t<std::is_enum_v<PropertyType>, int> = 0>
+    bool request(const EchonetLiteObject &destination, const PropertyType prop, Callback callback) {
+        return request(destination, static_cast<uint8_t>(prop), std::move(callback));
+    }
+
+    /// @brief 送信待ちの要求数
+    size_t pending() const {
+        return std::count_if(pendings.begin(), pendings.end(), [](const Pending &pending) { return pending.state == State::Queued; });
+    }
+
+    /// @brief 応答待ちの要求数
+    size_t inFlight() const {
+        return std::count_if(pendings.begin(), pendings.end(), [](const Pending &pending) { return pending.state == State::InFlight; });
+    }
+
+    /// @brief 保留中の要求をDEOJごとにまとめて送信
+    /// @note 送信できなかった要求は保留したまま次回に持ち越す。送信した要求は応答・タイムアウトまで
+    ///       保留領域に残し（要求元への振り分けに使う）、完了時に解放する
+    /// @return 送信したフレーム数
+    size_t flush(const uint32_t now) {
+        std::array<bool, MaxPending> visited = {};
+        size_t frames                        = 0;
+        for (size_t i = 0; i < MaxPending; i++) {
+            if (pendings[i].state != State::Queued || visited[i]) {
+                continue;
+            }
+            const EchonetLiteObject destination = pendings[i].destination;
+            std::array<uint8_t, MaxPropsPerFrame> properties;
+            std::array<bool, MaxPending> members = {};
+            size_t count                         = 0;
+            for (size_t j = i; j < MaxPending; j++) {
+                if (pendings[j].state != State::Queued || visited[j] || !isSameObject(pendings[j].destination, destination)) {
+                    continue;
+                }
+                uint8_t *const end = properties.data() + count;
+                if (std::find(properties.data(), end, pendings[j].property) == end) {
+                    if (count == maxPropertiesPerFrame) {
+                        // 次のフレームへ分割
+                        continue;
+                    }
+                    properties[count++] = pendings[j].property;
+                }
+                visited[j] = true;
+                members[j] = true;
+            }
+
+            Request request;
+            request.generateGetRequest(properties.data(), count);
+            request.data.EDATA.DEOJ = destination;
+            const uint16_t batch    = nextBatch++;
+            const bool submitted    = transactionManager.submit(request, now, [this, batch](Status status, const EchonetLite::EchonetLiteFrameView &frame) { complete(batch, status, frame); });
+            if (!submitted) {
+                continue;
+            }
+            for (size_t j = i; j < MaxPending; j++) {
+                if (members[j]) {
+                    pendings[j].state = State::InFlight;
+                    pendings[j].batch = batch;
+                }
+            }
+            frames++;
+        }
+        return frames;
+    }
+
+  private:
+    enum class State : uint8_t {
+        Free,     ///< 未使用
+        Queued,   ///< 送信待ち
+        InFlight, ///< 応答待ち
+    };
+
+    struct Pending {
+        State state = State::Free;
+        EchonetLiteObject destination;
+        uint8_t property;
+        uint16_t batch; ///< 送信したフレームの識別子（応答待ちの場合のみ有効）
+        Callback callback;
+    };
+
+    TransactionManager &transactionManager;
+    size_t maxPropertiesPerFrame;
+    std::array<Pending, MaxPending> pendings;
+    uint16_t nextBatch = 0;
+
+    /// @brief 送信したフレームの完了を要求元へ振り分ける
+    /// @note コールバックから新たに要求を保留できるよう、呼び出し前に領域を解放する
+    void complete(const uint16_t batch, const Status status, const EchonetLite::EchonetLiteFrameView &frame) {
+        for (Pending &pending : pendings) {
+            if (pending.state != State::InFlight || pending.batch != batch) {
+                continue;
+            }
+            const Callback callback = std::move(pending.callback);
+            pending.state           = State::Free;
+            pending.callback        = nullptr;
+            EchonetLitePropertyView property;
+            callback(status, frame.find(pending.property, &property) ? &property : nullptr);
+        }
+    }
+
+    static bool isSameObject(const EchonetLiteObject &a, const EchonetLiteObject &b) {
+        return a.classGroupCode == b.classGroupCode && a.classCode == b.classCode && a.instanceCode == b.instanceCode;
+    }
+};
\ No newline at end of file
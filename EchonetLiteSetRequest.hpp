@@ -0,0 +1,293 @@
+#pragma once
+
+#include "EchonetLiteDeviceClass.hpp"
+
+/// @brief SetC・SetI・SetGet要求の組み立てと応答の解析
+/// @details 書き込み値はプロパティ定義に従ってビッグエンディアンでエンコードする。SetGetでは複数EPCの書き込みと
+///          その読み出し（書き込み結果の確認）を1フレームにまとめられる
+/// @tparam DeviceClass 宛先の機器オブジェクトクラス（EchonetLiteDeviceClassの派生クラス）
+/// @tparam MaxFrameBytes 要求フレーム長の上限
+/// @note ヒープを確保しない
+template <class DeviceClass, size_t MaxFrameBytes = 256>
+class EchonetLiteSetRequest {
+    static_assert(MaxFrameBytes >= EchonetLite::minimumFrameSize + 3, "frame must hold EHD, EDATA and one property");
+
+  public:
+    using EchonetLiteHeader       = EchonetLite::EchonetLiteHeader;
+    using EchonetLiteData         = EchonetLite::EchonetLiteData;
+    using EchonetLiteService      = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView    = EchonetLite::EchonetLiteFrameView;
+    using EchonetLitePropertyView = EchonetLite::EchonetLitePropertyView;
+
+    static constexpr size_t maxFrameBytes = MaxFrameBytes;
+
+    /// @brief Set_Res・SetGet_Res・SetI_SNA・SetC_SNA・SetGet_SNAの非所有ビュー
+    /// @note 呼び出し元のバッファを参照するため、バッファより長く保持しないこと
+    class Response {
+      public:
+        using const_iterator = EchonetLiteFrameView::const_iterator;
+
+        EchonetLiteFrameView frame;             ///< フレームとSet部のプロパティ
+        const uint8_t *getProperties = nullptr; ///< Get部の先頭プロパティ（EPC）位置（SetGet_Res・SetGet_SNAのみ）
+        uint8_t getCount             = 0;       ///< 完全に受信できたGet部のプロパティ数
+        bool valid                   = false;   ///< Set要求への応答として解析できた
+
+        /// @brief 全てのプロパティが受理されたか（Set_Res・SetGet_Res）
+        bool isAccepted() const {
+            return valid && (frame.EDATA.echonetLiteService == EchonetLiteService::Set_Res || frame.EDATA.echonetLiteService == EchonetLiteService::SetGet_Res);
+        }
+
+        /// @brief 指定EPCの書き込みが受理されたか（Set部のPDCが0）
+        bool isSetAccepted(const uint8_t prop) const {
+            EchonetLitePropertyView property;
+            return valid && frame.find(prop, &property) && property.propertyDataCounter == 0;
+        }
+
+        /// @brief Get部のプロパティ列
+        const_iterator getBegin() const {
+            return const_iterator(getProperties, getCount);
+        }
+
+        const_iterator getEnd() const {
+            return const_iterator(nullptr, 0);
+        }
+
+        /// @brief Get部から指定EPCのプロパティ検索（読み出せなかったEPCはPDCが0）
+        bool findGet(const uint8_t prop, EchonetLitePropertyView *const out) const {
+            for (const_iterator it = getBegin(); it != getEnd(); ++it) {
+                const EchonetLitePropertyView property = *it;
+                if (property.echonetLiteProperty == prop) {
+                    *out = property;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// @brief Get部から特定プロパティのデータ取得（プロパティ定義による型付きデコード）
+        template <auto Prop>
+        bool get(typename DeviceClass::template PropertySchemaOf<Prop>::value_type *const out) const {
+            using Schema = typename DeviceClass::template PropertySchemaOf<Prop>;
+            EchonetLitePropertyView property;
+            if (!findGet(static_cast<uint8_t>(Prop), &property) || property.propertyDataCounter != Schema::size) {
+                return false;
+            }
+            const bool decoded = EchonetLite::decodeProperty<Schema>(property.payload, out);
+            EchonetLiteMetrics::countDecode(static_cast<uint8_t>(Prop), decoded);
+            return decoded;
+        }
+    };
+
+    uint16_t nextTransactionId = 0;
+
+    /// @brief 要求のヘッダ
+    /// @note EchonetLite::dataと同じ構成で、EchonetLiteTransactionManager::submit()に渡すとTIDを書き換える
+    struct EchonetLiteRequestHeader {
+        EchonetLiteHeader EHEAD;
+        EchonetLiteData EDATA;
+    } data;
+
+    explicit EchonetLiteSetRequest() {
+        format(EchonetLiteService::SetC, 0x01);
+    }
+
+    /// @brief 要求の開始（ヘッダ生成・TID採番）
+    /// @param service SetC・SetI・SetGetのいずれか
+    /// @note EchonetLiteTransactionManager::submit()で送信する場合、TIDはGet要求と共通にマネージャが採番し直す。
+    ///       単独で送信する場合はGet要求と同じカウンタをnextTransactionIdへ渡して採番後に書き戻す
+    /// @return それ以外のサービスの場合はfalse
+    bool begin(const EchonetLiteService service, const uint8_t instanceCode = 0x01) {
+        if (service != EchonetLiteService::SetC && service != EchonetLiteService::SetI && service != EchonetLiteService::SetGet) {
+            return false;
+        }
+        format(service, instanceCode);
+        data.EHEAD.TransactionId = ++nextTransactionId;
+        return true;
+    }
+
+    /// @brief 書き込みプロパティの追加（エンコード済みEDT）
+    /// @return プロパティ数・フレーム長が上限を超えた場合はfalse
+    bool addSet(const uint8_t prop, const uint8_t *const edt, const uint8_t counter) {
+        if (counter == 0 || data.EDATA.operationPropertyCounter == std::numeric_limits<uint8_t>::max() || size() + 2 + counter > MaxFrameBytes) {
+            return false;
+        }
+        setProperties[setLength++] = prop;
+        setProperties[setLength++] = counter;
+        memcpy(setProperties.data() + setLength, edt, counter);
+        setLength += counter;
+        data.EDATA.operationPropertyCounter++;
+        return true;
+    }
+
+    /// @brief 書き込みプロパティの追加（プロパティ定義によるエンコード）
+    template <auto Prop>
+    bool addSet(const typename DeviceClass::template PropertySchemaOf<Prop>::value_type &value) {
+        uint8_t edt[DeviceClass::template PropertySchemaOf<Prop>::size];
+        return addSet(static_cast<uint8_t>(Prop), edt, static_cast<uint8_t>(DeviceClass::template encode<Prop>(value, edt)));
+    }
+
+    /// @brief 読み出しプロパティの追加（SetGetのみ）
+    /// @return SetGet以外・プロパティ数・フレーム長が上限を超えた場合はfalse
+    bool addGet(const uint8_t prop) {
+        if (data.EDATA.echonetLiteService != EchonetLiteService::SetGet || getCount == std::numeric_limits<uint8_t>::max() || size() + 2 > MaxFrameBytes) {
+            return false;
+        }
+        getProperties[getCount++] = prop;
+        return true;
+    }
+
+    template <auto Prop>
+    bool addGet() {
+        return addGet(static_cast<uint8_t>(Prop));
+    }
+
+    /// @brief 書き込みと読み出し確認の追加（SetGetのみ）
+    /// @note 片方だけ追加された状態を残さない
+    template <auto Prop>
+    bool addSetGet(const typename DeviceClass::template PropertySchemaOf<Prop>::value_type &value) {
+        constexpr size_t counter = DeviceClass::template PropertySchemaOf<Prop>::size;
+        if (data.EDATA.echonetLiteService != EchonetLiteService::SetGet || data.EDATA.operationPropertyCounter == std::numeric_limits<uint8_t>::max() ||
+            getCount == std::numeric_limits<uint8_t>::max() || size() + 2 + counter + 2 > MaxFrameBytes) {
+            return false;
+        }
+        return addSet<Prop>(value) && addGet<Prop>();
+    }
+
+    /// @brief 要求のTID
+    uint16_t transactionId() const {
+        return data.EHEAD.TransactionId;
+    }
+
+    /// @brief 要求のフレーム長
+    size_t size() const {
+        return EchonetLite::minimumFrameSize + setLength + (data.EDATA.echonetLiteService == EchonetLiteService::SetGet ? 1 + getCount * 2 : 0);
+    }
+
+    /// @brief 呼び出し元バッファへバイナリフレームを直接書き込み
+    /// @return 書き込んだバイト数（書き込みプロパティがない・容量不足の場合は0）
+    size_t serializeTo(uint8_t *const out, const size_t cap) const {
+        if (data.EDATA.operationPropertyCounter == 0 || cap < size()) {
+            return 0;
+        }
+        size_t length = EchonetLite::serializeHeader(data.EHEAD, data.EDATA, out);
+        memcpy(out + length, setProperties.data(), setLength);
+        length += setLength;
+        if (data.EDATA.echonetLiteService == EchonetLiteService::SetGet) {
+            out[length++] = getCount;
+            for (uint8_t i = 0; i < getCount; i++) {
+                out[length++] = getProperties[i];
+                out[length++] = 0x00;
+            }
+        }
+        return length;
+    }
+
+    /// @brief 呼び出し元バッファへASCII16進フレームを直接書き込み（SKSENDTOのデータ部用）
+    /// @note 終端文字は付与しない
+    /// @return 書き込んだ文字数（書き込みプロパティがない・容量不足の場合は0）
+    size_t serializeHexTo(char *const out, const size_t cap) const {
+        uint8_t frame[MaxFrameBytes];
+        const size_t length = serializeTo(frame, sizeof(frame));
+        return length == 0 ? 0 : EchonetLite::encodeHex(frame, length, out, cap);
+    }
+
+    /// @brief 応答フレームの解析
+    /// @note 戻り値はbufを参照する
+    static Response parse(const uint8_t *buf, const size_t len) {
+        Response response;
+        response.frame = EchonetLite::load(buf, len);
+        if (!response.frame.valid || response.frame.truncated) {
+            return response;
+        }
+        switch (response.frame.EDATA.echonetLiteService) {
+            case EchonetLiteService::Set_Res:
+            case EchonetLiteService::SetI_SNA:
+            case EchonetLiteService::SetC_SNA:
+                response.valid = true;
+                return response;
+            case EchonetLiteService::SetGet_Res:
+            case EchonetLiteService::SetGet_SNA:
+                break;
+            default:
+                return response;
+        }
+
+        // Set部の直後にOPCGet・Get部が続く
+        const uint8_t *get = response.frame.properties;
+        for (const EchonetLitePropertyView property : response.frame) {
+            get = property.payload + property.propertyDataCounter;
+        }
+        const uint8_t *const end = buf + len;
+        if (get >= end) {
+            return response;
+        }
+        const uint8_t count    = *get++;
+        response.getProperties = get;
+        for (uint8_t i = 0; i < count; i++) {
+            if (get + 2 > end || get + 2 + get[1] > end) {
+                return response;
+            }
+            get += 2 + get[1];
+            response.getCount++;
+        }
+        response.valid = true;
+        return response;
+    }
+
+    /// @brief 指定EPCの書き込み確認
+    /// @details 書き込みが受理され、読み出しを要求していた場合は読み出し値が書き込み値と一致すること
+    /// @note 機器が書き込み値を丸めて保持する場合、読み出し値は一致しないことがある
+    bool isVerified(const Response &response, const uint8_t prop) const {
+        if (!response.valid || response.frame.EHEAD.TransactionId != data.EHEAD.TransactionId || !response.isSetAccepted(prop)) {
+            return false;
+        }
+        if (std::find(getProperties.begin(), getProperties.begin() + getCount, prop) == getProperties.begin() + getCount) {
+            return true;
+        }
+        const uint8_t *written = nullptr;
+        uint8_t counter        = 0;
+        for (size_t offset = 0; offset < setLength; offset += 2 + setProperties[offset + 1]) {
+            if (setProperties[offset] == prop) {
+                written = setProperties.data() + offset + 2;
+                counter = setProperties[offset + 1];
+                break;
+            }
+        }
+        EchonetLitePropertyView property;
+        return written != nullptr && response.findGet(prop, &property) && property.propertyDataCounter == counter && memcmp(property.payload, written, counter) == 0;
+    }
+
+    /// @brief 全ての書き込みプロパティの書き込み確認
+    bool verify(const Response &response) const {
+        for (size_t offset = 0; offset < setLength; offset += 2 + setProperties[offset + 1]) {
+            if (!isVerified(response, setProperties[offset])) {
+                return false;
+            }
+        }
+        return setLength > 0;
+    }
+
+  private:
+    /// @brief Set部（EPC・PDC・EDT列）
+    std::array<uint8_t, MaxFrameBytes - EchonetLite::minimumFrameSize> setProperties;
+    size_t setLength = 0;
+    /// @brief Get部のEPC列
+    std::array<uint8_t, (MaxFrameBytes - EchonetLite::minimumFrameSize) / 2> getProperties;
+    uint8_t getCount = 0;
+
+    void format(const EchonetLiteService service, const uint8_t instanceCode) {
+        memset(&data.EHEAD, 0, sizeof(data.EHEAD));
+        memset(&data.EDATA, 0, sizeof(data.EDATA));
+        data.EHEAD.head1                    = EchonetLite::EchonetLiteHeader1::NewEchonetLite;
+        data.EHEAD.head2                    = EchonetLite::EchonetLiteHeader2::Type1;
+        data.EHEAD.TransactionId            = nextTransactionId;
+        data.EDATA.SEOJ.classGroupCode      = EchonetLite::ClassGroupCode::ManagementOperationDeviceClassGroup;
+        data.EDATA.SEOJ.classCode           = static_cast<uint8_t>(EchonetLite::ClassCode::Controller);
+        data.EDATA.SEOJ.instanceCode        = 0x01;
+        data.EDATA.DEOJ                     = DeviceClass::eoj(instanceCode);
+        data.EDATA.echonetLiteService       = service;
+        data.EDATA.operationPropertyCounter = 0;
+        setLength                           = 0;
+        getCount                            = 0;
+    }
+};
\ No newline at end of file
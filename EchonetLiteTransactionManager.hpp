@@ -0,0 +1,251 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+#include <functional>
+
+/// @brief 複数の応答待ち要求を管理するトランザクションテーブル
+/// @tparam MaxInFlight 同時に応答待ちにできる要求数
+/// @tparam MaxFrameBytes 再送用に保持する要求フレーム長の上限
+/// @note 時刻は呼び出し元のミリ秒カウンタ（millis()等）で与える。周回しても比較できる
+template <size_t MaxInFlight, size_t MaxFrameBytes = 64>
+class EchonetLiteTransactionManager {
+  public:
+    using EchonetLiteService   = EchonetLite::EchonetLiteService;
+    using EchonetLiteFrameView = EchonetLite::EchonetLiteFrameView;
+
+    /// @brief 要求の完了状態
+    enum class Status : uint8_t {
+        Completed,    ///< 要求受理応答（Get_Res・Set_Res等）を受信（SetIは応答待ち時間内に不可応答がなかった）
+        NotAvailable, ///< 不可応答（*_SNA）を受信
+        Timeout,      ///< 再送を含めて応答がなかった
+    };
+
+    /// @brief 完了通知（Timeout・SetIのCompletedの場合frameは無効なビュー）
+    using Callback = std::function<void(Status status, const EchonetLiteFrameView &frame)>;
+
+    /// @brief フレーム送信（送信できた場合true）
+    using Sender = std::function<bool(const uint8_t *frame, size_t length)>;
+
+    static constexpr uint32_t defaultTimeout = 3000; ///< 応答待ち時間[ms]
+    static constexpr uint8_t defaultRetries  = 2;    ///< 再送回数
+
+    uint16_t nextTransactionId = 0;
+
+    explicit EchonetLiteTransactionManager(Sender sender) : sender(std::move(sender)) {}
+
+    /// @brief 要求の送信と登録
+    /// @note 要求のTIDはテーブル内で重複しない値に書き換える
+    /// @return 空きがない・フレームが大きすぎる・送信に失敗した場合はfalse
+    template <class Packet>
+    bool submit(Packet &request, const uint32_t now, Callback callback, const uint32_t timeout = defaultTimeout, const uint8_t retries = defaultRetries) {
+        Transaction *const transaction = findFree();
+        if (transaction == nullptr) {
+            return false;
+        }
+        request.data.EHEAD.TransactionId = allocateTransactionId();
+        const size_t length              = request.serializeTo(transaction->frame.data(), transaction->frame.size());
+        if (length == 0 || !sender(transaction->frame.data(), length)) {
+            return false;
+        }
+        transaction->active        = true;
+        transaction->transactionId = request.data.EHEAD.TransactionId;
+        transaction->destination   = request.data.EDATA.DEOJ;
+        transaction->service       = request.data.EDATA.echonetLiteService;
+        transaction->frameLength   = length;
+        transaction->timeout       = timeout;
+        transaction->deadline      = now + timeout;
+        transaction->sentAt        = now;
+        transaction->retries       = retries;
+        transaction->attempt       = 0;
+        transaction->callback      = std::move(callback);
+        return true;
+    }
+
+    /// @brief 受信フレームの照合
+    /// @return 応答待ち要求に対応する応答だった場合はtrue
+    bool receive(const EchonetLiteFrameView &frame) {
+        Status status;
+        Transaction *const transaction = match(frame, &status);
+        if (transaction == nullptr) {
+            return false;
+        }
+        complete(*transaction, status, frame);
+        return true;
+    }
+
+    /// @brief 受信フレームの照合（応答時間を計測値に記録する）
+    /// @note 応答時間は最初の送信からの経過時間
+    bool receive(const EchonetLiteFrameView &frame, const uint32_t now) {
+        Status status;
+        Transaction *const transaction = match(frame, &status);
+        if (transaction == nullptr) {
+            return false;
+        }
+        const EchonetLite::EchonetLiteObject &object = transaction->destination;
+        EchonetLiteMetrics::recordLatency((static_cast<uint32_t>(object.classGroupCode) << 16) | (object.classCode << 8) | object.instanceCode, now - transaction->sentAt);
+        complete(*transaction, status, frame);
+        return true;
+    }
+
+    /// @brief 受信フレームの照合（バイナリ）
+    bool receive(const uint8_t *buf, const size_t len) {
+        return receive(EchonetLite::load(buf, len));
+    }
+
+    /// @brief 応答期限切れの再送・タイムアウト処理
+    /// @note 再送間隔は試行ごとに倍にする。SetIは受理時に応答しないため再送せず、期限までに不可応答がなければ完了とする
+    void poll(const uint32_t now) {
+        for (Transaction &transaction : transactions) {
+            if (!transaction.active || static_cast<int32_t>(now - transaction.deadline) < 0) {
+                continue;
+            }
+            if (transaction.service == EchonetLiteService::SetI) {
+                complete(transaction, Status::Completed, EchonetLiteFrameView());
+                continue;
+            }
+            if (transaction.attempt < transaction.retries) {
+                // 送信に失敗した場合も要求は残し、次の期限で再送する
+                transaction.attempt++;
+                transaction.deadline = now + (transaction.timeout << transaction.attempt);
+                sender(transaction.frame.data(), transaction.frameLength);
+                continue;
+            }
+            complete(transaction, Status::Timeout, EchonetLiteFrameView());
+        }
+    }
+
+    /// @brief 応答待ち要求数
+    size_t inFlight() const {
+        return std::count_if(transactions.begin(), transactions.end(), [](const Transaction &transaction) { return transaction.active; });
+    }
+
+    /// @brief 指定TIDの要求を応答待ちから外す（コールバックは呼ばない）
+    bool cancel(const uint16_t transactionId) {
+        for (Transaction &transaction : transactions) {
+            if (transaction.active && transaction.transactionId == transactionId) {
+                transaction.active   = false;
+                transaction.callback = nullptr;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief 要求ESVに対応する応答ESVか判定
+    static bool matchResponse(const EchonetLiteService request, const EchonetLiteService response, Status *const status) {
+        EchonetLiteService accepted;
+        EchonetLiteService rejected;
+        switch (request) {
+            case EchonetLiteService::SetI:
+                // SetIは受理時に応答しないため、不可応答のみ照合する
+                if (response == EchonetLiteService::SetI_SNA) {
+                    *status = Status::NotAvailable;
+                    return true;
+                }
+                return false;
+            case EchonetLiteService::SetC:
+                accepted = EchonetLiteService::Set_Res;
+                rejected = EchonetLiteService::SetC_SNA;
+                break;
+            case EchonetLiteService::Get:
+                accepted = EchonetLiteService::Get_Res;
+                rejected = EchonetLiteService::Get_SNA;
+                break;
+            case EchonetLiteService::INF_REQ:
+                accepted = EchonetLiteService::INF;
+                rejected = EchonetLiteService::INF_SNA;
+                break;
+            case EchonetLiteService::SetGet:
+                accepted = EchonetLiteService::SetGet_Res;
+                rejected = EchonetLiteService::SetGet_SNA;
+                break;
+            default:
+                return false;
+        }
+        if (response == rejected) {
+            *status = Status::NotAvailable;
+            return true;
+        }
+        if (response == accepted) {
+            *status = Status::Completed;
+            return true;
+        }
+        return false;
+    }
+
+  private:
+    struct Transaction {
+        bool active = false;
+        uint16_t transactionId;
+        EchonetLite::EchonetLiteObject destination;
+        EchonetLiteService service;
+        std::array<uint8_t, MaxFrameBytes> frame;
+        size_t frameLength;
+        uint32_t timeout;
+        uint32_t deadline;
+        uint32_t sentAt;
+        uint8_t retries;
+        uint8_t attempt;
+        Callback callback;
+    };
+
+    Sender sender;
+    std::array<Transaction, MaxInFlight> transactions;
+
+    /// @brief 受信フレームに対応する応答待ち要求の検索
+    Transaction *match(const EchonetLiteFrameView &frame, Status *const status) {
+        if (!frame.valid) {
+            return nullptr;
+        }
+        for (Transaction &transaction : transactions) {
+            if (!transaction.active || transaction.transactionId != frame.EHEAD.TransactionId) {
+                continue;
+            }
+            if (!isSameClass(transaction.destination, frame.EDATA.SEOJ)) {
+                continue;
+            }
+            if (matchResponse(transaction.service, frame.EDATA.echonetLiteService, status)) {
+                return &transaction;
+            }
+        }
+        EchonetLiteMetrics::countUnmatchedResponse();
+        return nullptr;
+    }
+
+    Transaction *findFree() {
+        for (Transaction &transaction : transactions) {
+            if (!transaction.active) {
+                return &transaction;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief 応答待ち要求と重複しないTIDの払い出し
+    uint16_t allocateTransactionId() {
+        while (true) {
+            const uint16_t transactionId = ++nextTransactionId;
+            const bool used              = std::any_of(transactions.begin(), transactions.end(), [transactionId](const Transaction &transaction) {
+                return transaction.active && transaction.transactionId == transactionId;
+            });
+            if (!used) {
+                return transactionId;
+            }
+        }
+    }
+
+    /// @brief 応答元が要求先と同じクラスか判定（インスタンスは一斉同報を考慮し比較しない）
+    static bool isSameClass(const EchonetLite::EchonetLiteObject &destination, const EchonetLite::EchonetLiteObject &source) {
+        return destination.classGroupCode == source.classGroupCode && destination.classCode == source.classCode;
+    }
+
+    void complete(Transaction &transaction, const Status status, const EchonetLiteFrameView &frame) {
+        // コールバック内から再度submitできるよう先に解放する
+        Callback callback    = std::move(transaction.callback);
+        transaction.active   = false;
+        transaction.callback = nullptr;
+        if (callback) {
+            callback(status, frame);
+        }
+    }
+};
\ No newline at end of file
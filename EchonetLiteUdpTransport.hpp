@@ -0,0 +1,275 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <functional>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// @brief Linuxホスト向けUDPトランスポート（epoll・recvmmsg・sendmmsgによる一括送受信）
+/// @details 受信バッファ上のフレームをコピーせずにEchonetLiteFrameViewとして通知する
+/// @tparam Batch 1回のシステムコールで送受信するフレーム数の上限
+/// @note 受信バッファを保持するため大きいので、静的領域またはヒープに置く
+template <size_t Batch = 32>
+class EchonetLiteUdpTransport {
+  public:
+    using EchonetLiteFrameView = EchonetLite::EchonetLiteFrameView;
+
+    /// @brief ECHONET Liteの既定ポート
+    static constexpr uint16_t defaultPort = 3610;
+    /// @brief ECHONET LiteのIPv4マルチキャストアドレス（224.0.23.0）
+    static constexpr uint32_t multicastAddress = 0xE0001700;
+    /// @brief 1フレームの最大長（Ethernet MTUに収まるUDPペイロード長）
+    static constexpr size_t maxFrameBytes = 1472;
+
+    /// @brief 受信通知（送信元アドレス、フレーム）
+    /// @note frameの参照先は通知の間だけ有効
+    using Handler = std::function<void(const sockaddr_in &from, const EchonetLiteFrameView &frame)>;
+
+    explicit EchonetLiteUdpTransport() {
+        for (size_t i = 0; i < Batch; i++) {
+            rxIov[i]                         = {rxBuffers[i].data(), maxFrameBytes};
+            rxMessages[i].msg_hdr            = {};
+            rxMessages[i].msg_hdr.msg_iov    = &rxIov[i];
+            rxMessages[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    ~EchonetLiteUdpTransport() {
+        close();
+    }
+
+    EchonetLiteUdpTransport(const EchonetLiteUdpTransport &)            = delete;
+    EchonetLiteUdpTransport &operator=(const EchonetLiteUdpTransport &) = delete;
+
+    /// @brief ソケットの作成と待ち受け開始
+    /// @param port 待ち受けポート（ループバック試験では既定以外を指定できる）
+    /// @param interfaceAddress マルチキャストの送受信に使うインタフェースのアドレス（INADDR_ANYで既定）
+    /// @param joinMulticast 224.0.23.0へ参加するか
+    /// @return 失敗した場合はfalse
+    bool open(const uint16_t port = defaultPort, const in_addr_t interfaceAddress = htonl(INADDR_ANY), const bool joinMulticast = true) {
+        close();
+        socketFd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (socketFd < 0) {
+            return false;
+        }
+        const int enable = 1;
+        setsockopt(socketFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        sockaddr_in local     = {};
+        local.sin_family      = AF_INET;
+        local.sin_port        = htons(port);
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (bind(socketFd, reinterpret_cast<const sockaddr *>(&local), sizeof(local)) != 0) {
+            close();
+            return false;
+        }
+        if (joinMulticast) {
+            ip_mreq membership              = {};
+            membership.imr_multiaddr.s_addr = htonl(multicastAddress);
+            membership.imr_interface.s_addr = interfaceAddress;
+            in_addr outgoing                = {};
+            outgoing.s_addr                 = interfaceAddress;
+            if (setsockopt(socketFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0 ||
+                setsockopt(socketFd, IPPROTO_IP, IP_MULTICAST_IF, &outgoing, sizeof(outgoing)) != 0) {
+                close();
+                return false;
+            }
+        }
+
+        epollFd           = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event event = {};
+        event.events      = EPOLLIN;
+        event.data.fd     = socketFd;
+        if (epollFd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, socketFd, &event) != 0) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief ソケットを閉じる（未送信のフレームは破棄する）
+    void close() {
+        if (epollFd >= 0) {
+            ::close(epollFd);
+            epollFd = -1;
+        }
+        if (socketFd >= 0) {
+            ::close(socketFd);
+            socketFd = -1;
+        }
+        txCount = 0;
+    }
+
+    /// @brief 待ち受けポート（0で未オープン）
+    uint16_t localPort() const {
+        sockaddr_in local = {};
+        socklen_t length  = sizeof(local);
+        if (socketFd < 0 || getsockname(socketFd, reinterpret_cast<sockaddr *>(&local), &length) != 0) {
+            return 0;
+        }
+        return ntohs(local.sin_port);
+    }
+
+    /// @brief 他のイベントループに登録するためのepollディスクリプタ
+    int fd() const {
+        return epollFd;
+    }
+
+    /// @brief 送信キューへの追加（キューが満杯の場合は先に送信する）
+    /// @return フレームが長すぎる場合・送信キューが満杯のまま送信できなかった場合はfalse
+    bool send(const sockaddr_in &destination, const uint8_t *frame, const size_t length) {
+        if (length > maxFrameBytes) {
+            return false;
+        }
+        if (txCount == Batch) {
+            flush();
+            if (txCount == Batch) {
+                return false;
+            }
+        }
+        enqueue(destination, frame, length);
+        return true;
+    }
+
+    /// @brief 224.0.23.0への送信キューへの追加
+    bool sendMulticast(const uint8_t *frame, const size_t length, const uint16_t port = defaultPort) {
+        return send(makeAddress(multicastAddress, port), frame, length);
+    }
+
+    /// @brief 送信キューのフレームをまとめて送信
+    /// @note 送信バッファが満杯（EAGAIN等）で送信できなかったフレームはキューに残し、次回のflush()・poll()で送信する。
+    ///       それ以外のエラーで送信できなかったフレームは破棄し、droppedFrames()に数える
+    /// @return 送信できたフレーム数
+    size_t flush() {
+        size_t sent    = 0;
+        size_t removed = 0;
+        while (removed < txCount) {
+            const int result = sendmmsg(socketFd, txMessages.data() + removed, txCount - removed, 0);
+            if (result > 0) {
+                sent += result;
+                removed += result;
+                continue;
+            }
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result == 0 || errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+                break;
+            }
+            // 先頭のフレームが送信できない（宛先不正等）
+            dropped++;
+            removed++;
+        }
+        // 未送信のフレームをキューの先頭へ詰める
+        const size_t remaining = txCount - removed;
+        txCount                = 0;
+        for (size_t i = 0; i < remaining; i++) {
+            const size_t from = removed + i;
+            enqueue(txAddresses[from], txBuffers[from].data(), txIov[from].iov_len);
+        }
+        return sent;
+    }
+
+    /// @brief 送信キューのフレーム数
+    size_t queued() const {
+        return txCount;
+    }
+
+    /// @brief 送信エラーで破棄したフレーム数（累計）
+    size_t droppedFrames() const {
+        return dropped;
+    }
+
+    /// @brief 受信バッファに収まらず破棄したフレーム数（累計）
+    size_t truncatedFrames() const {
+        return truncated;
+    }
+
+    /// @brief 受信フレームの待ち受けと通知
+    /// @param timeout epoll_waitのタイムアウト[ms]（0で待たない、-1で無期限）
+    /// @note 受信キューが空になるまでrecvmmsgで読み出す。受信前に送信キューを送信する
+    /// @return 通知したフレーム数（不正なフレーム・受信バッファに収まらなかったフレームは通知しない）
+    size_t poll(const int timeout, const Handler &handler) {
+        flush();
+        epoll_event event;
+        if (epoll_wait(epollFd, &event, 1, timeout) <= 0) {
+            return 0;
+        }
+        size_t dispatched = 0;
+        while (true) {
+            for (size_t i = 0; i < Batch; i++) {
+                rxMessages[i].msg_hdr.msg_name    = &rxAddresses[i];
+                rxMessages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+            const int received = recvmmsg(socketFd, rxMessages.data(), Batch, MSG_DONTWAIT, nullptr);
+            if (received <= 0) {
+                break;
+            }
+            for (int i = 0; i < received; i++) {
+                if (rxMessages[i].msg_hdr.msg_flags & MSG_TRUNC) {
+                    // maxFrameBytesを超えるデータグラムは末尾が欠けているため通知しない
+                    truncated++;
+                    continue;
+                }
+                const EchonetLiteFrameView frame = EchonetLite::load(rxBuffers[i].data(), rxMessages[i].msg_len);
+                if (frame.valid) {
+                    handler(rxAddresses[i], frame);
+                    dispatched++;
+                }
+            }
+            if (static_cast<size_t>(received) < Batch) {
+                break;
+            }
+        }
+        return dispatched;
+    }
+
+    /// @brief IPv4アドレス（ホストバイトオーダー）とポートから宛先を生成
+    static sockaddr_in makeAddress(const uint32_t address, const uint16_t port = defaultPort) {
+        sockaddr_in result     = {};
+        result.sin_family      = AF_INET;
+        result.sin_port        = htons(port);
+        result.sin_addr.s_addr = htonl(address);
+        return result;
+    }
+
+  private:
+    int socketFd = -1;
+    int epollFd  = -1;
+
+    std::array<std::array<uint8_t, maxFrameBytes>, Batch> rxBuffers;
+    std::array<sockaddr_in, Batch> rxAddresses;
+    std::array<iovec, Batch> rxIov;
+    std::array<mmsghdr, Batch> rxMessages;
+
+    std::array<std::array<uint8_t, maxFrameBytes>, Batch> txBuffers;
+    std::array<sockaddr_in, Batch> txAddresses;
+    std::array<iovec, Batch> txIov;
+    std::array<mmsghdr, Batch> txMessages;
+    size_t txCount = 0;
+
+    size_t dropped   = 0;
+    size_t truncated = 0;
+
+    /// @brief 送信キューの末尾への格納
+    /// @note frameはtxBuffers内の後方の領域でもよい（キューを詰める場合）
+    void enqueue(const sockaddr_in &destination, const uint8_t *frame, const size_t length) {
+        memmove(txBuffers[txCount].data(), frame, length);
+        txAddresses[txCount]                    = destination;
+        txIov[txCount]                          = {txBuffers[txCount].data(), length};
+        txMessages[txCount].msg_hdr             = {};
+        txMessages[txCount].msg_hdr.msg_name    = &txAddresses[txCount];
+        txMessages[txCount].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        txMessages[txCount].msg_hdr.msg_iov     = &txIov[txCount];
+        txMessages[txCount].msg_hdr.msg_iovlen  = 1;
+        txCount++;
+    }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "HousingFacilitiesDevice.hpp"
+
+class ElectricVehicleChargerDischargerClass : public HousingFacilitiesDevice<ElectricVehicleChargerDischargerClass, HousingFacilitiesClassCode::ElectricVehicleChargerDischarger> {
+  public:
+    /// @brief 電気自動車充放電器クラス
+    /// @version APPENDIX ECHONET 機器オブジェクト詳細規定 Release R
+    enum class Property : uint8_t {
+        DischargeableCapacity1                  = 0xC0, ///< 車載電池の放電可能容量値1
+        RemainingDischargeableCapacity1         = 0xC2, ///< 車載電池の放電可能残容量1
+        RemainingDischargeableCapacity3         = 0xC4, ///< 車載電池の放電可能残容量3
+        RatedChargeCapacity                     = 0xC5, ///< 定格充電能力
+        RatedDischargeCapacity                  = 0xC6, ///< 定格放電能力
+        VehicleConnectionStatus                 = 0xC7, ///< 車両接続・充放電可否状態
+        MinimumMaximumChargingPower             = 0xC8, ///< 最小最大充電電力値
+        MinimumMaximumDischargingPower          = 0xC9, ///< 最小最大放電電力値
+        ChargerDischargerType                   = 0xCC, ///< 充放電器タイプ
+        InstantaneousChargingDischargingPower   = 0xD3, ///< 瞬時充放電電力計測値（充電が正）
+        InstantaneousChargingDischargingCurrent = 0xD4, ///< 瞬時充放電電流計測値（充電が正）
+        InstantaneousChargingDischargingVoltage = 0xD5, ///< 瞬時充放電電圧計測値（充電が正）
+        CumulativeDischargingEnergy             = 0xD6, ///< 積算放電電力量計測値
+        CumulativeChargingEnergy                = 0xD8, ///< 積算充電電力量計測値
+        OperationModeSetting                    = 0xDA, ///< 運転モード設定
+        RemainingBatteryCapacity1               = 0xE2, ///< 車載電池の電池残容量1
+        RemainingBatteryCapacity3               = 0xE4, ///< 車載電池の電池残容量3
+        ChargingAmountSetting1                  = 0xE7, ///< 充電量設定値1
+        ChargingPowerSetting                    = 0xEB, ///< 充電電力設定値
+        DischargingPowerSetting                 = 0xEC, ///< 放電電力設定値
+    };
+
+    /// @brief 運転モード設定の値
+    enum class OperationMode : uint8_t {
+        Other       = 0x40, ///< その他
+        Charging    = 0x42, ///< 充電
+        Discharging = 0x43, ///< 放電
+        Standby     = 0x44, ///< 待機
+        Idle        = 0x47, ///< 停止
+    };
+
+    /// @brief 車両接続・充放電可否状態の値
+    enum class VehicleConnection : uint8_t {
+        NotConnected            = 0x30, ///< 車両未接続
+        Connected               = 0x40, ///< 車両接続・充電不可・放電不可
+        Chargeable              = 0x41, ///< 車両接続・充電可・放電不可
+        Dischargeable           = 0x42, ///< 車両接続・充電不可・放電可
+        ChargeableDischargeable = 0x43, ///< 車両接続・充電可・放電可
+        Undefined               = 0xFF, ///< 不定
+    };
+
+    /// @brief EPCごとのプロパティ定義
+    template <Property Prop, class = void>
+    struct PropertySchema;
+
+    template <class Dummy>
+    struct PropertySchema<Property::DischargeableCapacity1, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RemainingDischargeableCapacity1, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RemainingDischargeableCapacity3, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RatedChargeCapacity, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RatedDischargeCapacity, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::VehicleConnectionStatus, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::MinimumMaximumChargingPower, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::MinimumMaximumDischargingPower, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ChargerDischargerType, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousChargingDischargingPower, Dummy> : EchonetLitePropertyDescriptor<0, true, int32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousChargingDischargingCurrent, Dummy> : EchonetLitePropertyDescriptor<-1, true, int16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousChargingDischargingVoltage, Dummy> : EchonetLitePropertyDescriptor<0, true, int16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeDischargingEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeChargingEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::OperationModeSetting, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RemainingBatteryCapacity1, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RemainingBatteryCapacity3, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ChargingAmountSetting1, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ChargingPowerSetting, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::DischargingPowerSetting, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+};
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "HousingFacilitiesDevice.hpp"
+
+class HighVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDevice<HighVoltageSmartElectricEnergyMeterClass, HousingFacilitiesClassCode::HighVoltageSmartElectricMeter> {
+  public:
+    /// @brief 高圧スマート電力量メータクラス（係数・積算有効電力量）
+    /// @version APPENDIX ECHONET 機器オブジェクト詳細規定 Release R
+    enum class Property : uint8_t {
+        Coefficient                = 0xD3, ///< 係数
+        CertifiedNumber            = 0xD5, ///< 計器認定番号
+        TestExpirationDate         = 0xD6, ///< 検定満了年月
+        CumulativeActiveEnergy     = 0xE0, ///< 積算有効電力量計測値
+        CumulativeActiveEnergyUnit = 0xE1, ///< 積算有効電力量単位
+    };
+
+    /// @brief EPCごとのプロパティ定義
+    template <Property Prop, class = void>
+    struct PropertySchema;
+
+    template <class Dummy>
+    struct PropertySchema<Property::Coefficient, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeActiveEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeActiveEnergyUnit, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+};
\ No newline at end of file
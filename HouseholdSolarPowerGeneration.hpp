@@ -0,0 +1,56 @@
+#pragma once
+
+#include "HousingFacilitiesDevice.hpp"
+
+class HouseholdSolarPowerGenerationClass : public HousingFacilitiesDevice<HouseholdSolarPowerGenerationClass, HousingFacilitiesClassCode::HouseholdSolarPowerGeneration> {
+  public:
+    /// @brief 住宅用太陽光発電クラス
+    /// @version APPENDIX ECHONET 機器オブジェクト詳細規定 Release R
+    enum class Property : uint8_t {
+        OutputPowerControlSetting1               = 0xA0, ///< 出力制御設定1（定格に対する割合[%]）
+        OutputPowerControlSetting2               = 0xA1, ///< 出力制御設定2（電力[W]）
+        SurplusElectricityPurchaseControl        = 0xA2, ///< 余剰買取制御機能設定
+        OutputPowerRestraintStatus               = 0xB0, ///< 出力抑制状態
+        SystemInterconnectionStatus              = 0xD0, ///< 系統連系状態
+        InstantaneousPowerGeneration             = 0xE0, ///< 瞬時発電電力計測値
+        CumulativePowerGeneration                = 0xE1, ///< 積算発電電力量計測値
+        CumulativeSoldPower                      = 0xE3, ///< 積算売電電力量計測値
+        RatedPowerGenerationSystemInterconnected = 0xE8, ///< 定格発電電力値（系統連系時）
+        RatedPowerGenerationIndependentOperation = 0xE9, ///< 定格発電電力値（独立時）
+    };
+
+    /// @brief EPCごとのプロパティ定義
+    /// @note 電力量は0.001kWh（Wh）単位
+    template <Property Prop, class = void>
+    struct PropertySchema;
+
+    template <class Dummy>
+    struct PropertySchema<Property::OutputPowerControlSetting1, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::OutputPowerControlSetting2, Dummy> : EchonetLitePropertyDescriptor<0, true, uint16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::SurplusElectricityPurchaseControl, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::OutputPowerRestraintStatus, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::SystemInterconnectionStatus, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousPowerGeneration, Dummy> : EchonetLitePropertyDescriptor<0, true, uint16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativePowerGeneration, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeSoldPower, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RatedPowerGenerationSystemInterconnected, Dummy> : EchonetLitePropertyDescriptor<0, true, uint16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RatedPowerGenerationIndependentOperation, Dummy> : EchonetLitePropertyDescriptor<0, true, uint16_t> {};
+};
\ No newline at end of file
@@ -1,16 +1,37 @@
 #pragma once
 
-#include "EchonetLite.hpp"
+#include "EchonetLiteDeviceClass.hpp"
 
-class HousingFacilitiesDeviceClass : public EchonetLite {
+/// @brief 住宅・設備関連機器クラスグループのクラスコード
+enum class HousingFacilitiesClassCode : uint8_t {
+    HouseholdSolarPowerGeneration    = 0x79, // 住宅用太陽光発電
+    StorageBattery                   = 0x7D, // 蓄電池
+    ElectricVehicleChargerDischarger = 0x7E, // 電気自動車充放電器
+    LowVoltageSmartElectricMeter     = 0x88, // 低圧スマート電力量メータ
+    HighVoltageSmartElectricMeter    = 0x8A, // 高圧スマート電力量メータ
+};
+
+/// @brief 住宅・設備関連機器クラスグループの機器オブジェクト（従来のクラス）
+/// @deprecated 機器オブジェクトクラスはHousingFacilitiesDevice（EchonetLiteDeviceClass）から派生させること。
+///             クラスコードはHousingFacilitiesClassCodeを使うこと
+class [[deprecated("derive from HousingFacilitiesDevice<Derived, HousingFacilitiesClassCode> instead")]] HousingFacilitiesDeviceClass : public EchonetLite {
   public:
-    enum class ClassCode : uint8_t {
-        LowVoltageSmartElectricMeter = 0x88, // 低圧スマート電力量メータ
-    };
+    using ClassCode = HousingFacilitiesClassCode;
+
+    using EchonetLite::generateGetRequest;
 
     template <class PropertyType>
     void generateGetRequest(const std::vector<PropertyType> &property) {
         EchonetLite::generateGetRequest(property);
         this->data.EDATA.DEOJ.classGroupCode = EchonetLite::ClassGroupCode::HousingFacilitiesDeviceClassGroup;
     }
-};
\ No newline at end of file
+
+    void generateGetRequest(const uint8_t *properties, const size_t count) {
+        EchonetLite::generateGetRequest(properties, count);
+        this->data.EDATA.DEOJ.classGroupCode = EchonetLite::ClassGroupCode::HousingFacilitiesDeviceClassGroup;
+    }
+};
+
+/// @brief 住宅・設備関連機器クラスグループの機器オブジェクトクラス（CRTP）
+template <class Derived, HousingFacilitiesClassCode Class>
+using HousingFacilitiesDevice = EchonetLiteDeviceClass<Derived, EchonetLite::ClassGroupCode::HousingFacilitiesDeviceClassGroup, static_cast<uint8_t>(Class)>;
\ No newline at end of file
@@ -2,11 +2,37 @@
 
 #include "HousingFacilitiesDevice.hpp"
 
-class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceClass {
+class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDevice<LowVoltageSmartElectricEnergyMeterClass, HousingFacilitiesClassCode::LowVoltageSmartElectricMeter> {
+    using Base = HousingFacilitiesDevice<LowVoltageSmartElectricEnergyMeterClass, HousingFacilitiesClassCode::LowVoltageSmartElectricMeter>;
+    friend Base;
+
   private:
     bool initializedParameter             = false;
-    double cumulativeEnergyUnit           = 1.0; ///< 積算電力量単位デフォルト値
-    uint32_t syntheticTransformationRatio = 1;   ///< 係数デフォルト値
+    double cumulativeEnergyUnit           = 1.0;     ///< 積算電力量単位デフォルト値
+    int8_t cumulativeEnergyUnitExponent   = 0;       ///< 積算電力量単位の10の指数[kWh]
+    uint32_t syntheticTransformationRatio = 1;       ///< 係数デフォルト値
+    int64_t cumulativeEnergyScaleMilli    = 1000000; ///< 計測値1あたりの電力量[mWh]
+
+    /// @brief 係数と単位はあらかじめパースしておく
+    void initParameterFromPayload() {
+        for (const EchonetLite::EchonetLitePayload &payload : this->data.payload) {
+            switch (static_cast<Property>(payload.echonetLiteProperty)) {
+                case LowVoltageSmartElectricEnergyMeterClass::Property::CumulativeEnergyUnit:
+                    initCumulativeEnergyUnit();
+                    break;
+                case LowVoltageSmartElectricEnergyMeterClass::Property::Coefficient:
+                    initSyntheticTransformationRatio();
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    /// @brief レスポンス取り込み後の処理
+    void onLoad() {
+        initParameterFromPayload();
+    }
 
   public:
     /// @brief 低圧スマート電力量メータクラス
@@ -38,10 +64,188 @@ class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceCl
         DateOfCollectCumulativeEnergyHistory3 = 0xEF, ///< 積算履歴収集日３
     };
 
+    /// @brief 積算電力量計測値履歴のコマ列（ワイヤバッファを直接参照する非所有レンジ）
+    /// @tparam Fields 1コマあたりの計測値数（正方向のみ・逆方向のみは1、正逆両方は2）
+    /// @note 未計測値（0x05F5E0FF超）を含むコマは読み飛ばす
+    template <size_t Fields>
+    class CumulativeEnergyHistoryRange {
+      public:
+        static constexpr size_t slotSize        = sizeof(uint32_t) * Fields;
+        static constexpr uint32_t maxValidValue = 99999999;
+
+        /// @brief 1コマ分の計測値
+        struct Slot {
+            uint8_t index;                      ///< コマ番号（先頭コマが0）
+            std::array<uint32_t, Fields> value; ///< 生値
+            std::array<float, Fields> energy;   ///< 係数・単位適用後の積算電力量[kWh]
+        };
+
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = Slot;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const Slot *;
+            using reference         = Slot;
+
+            const_iterator(const CumulativeEnergyHistoryRange *range, uint8_t index) : range(range), index(index) {
+                skipInvalid();
+            }
+
+            Slot operator*() const {
+                Slot slot;
+                slot.index = index;
+                for (size_t i = 0; i < Fields; i++) {
+                    slot.value[i]  = range->rawValue(index, i);
+                    slot.energy[i] = slot.value[i] * range->scale;
+                }
+                return slot;
+            }
+
+            const_iterator &operator++() {
+                index++;
+                skipInvalid();
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const const_iterator &other) const {
+                return index == other.index;
+            }
+
+            bool operator!=(const const_iterator &other) const {
+                return !(*this == other);
+            }
+
+          private:
+            const CumulativeEnergyHistoryRange *range;
+            uint8_t index;
+
+            void skipInvalid() {
+                while (index < range->count && !range->isValidSlot(index)) {
+                    index++;
+                }
+            }
+        };
+
+        CumulativeEnergyHistoryRange() = default;
+
+        /// @brief 未計測のコマに書き込む値（convertの出力）
+        static constexpr int64_t invalidMilliWattHour = -1;
+
+        CumulativeEnergyHistoryRange(const uint8_t *slots, const uint8_t count, const float scale, const int64_t scaleMilli = 0)
+            : slots(slots), count(count), scale(scale), scaleMilli(scaleMilli) {}
+
+        const_iterator begin() const {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const {
+            return const_iterator(this, count);
+        }
+
+        /// @brief 未計測を含むコマ数
+        uint8_t size() const {
+            return count;
+        }
+
+        /// @brief 全コマの積算電力量[mWh]を一括変換
+        /// @param out size()個の出力先（未計測のコマはinvalidMilliWattHour）
+        /// @param field 変換する計測値（正方向のみ・逆方向のみは0、正逆両方は0:正方向 1:逆方向）
+        /// @return 有効なコマ数（係数・単位が未設定の場合・計測値との積がint64_tに収まらないコマがある場合は0で、outは書き換えない）
+        size_t convert(int64_t *const out, const size_t field = 0) const {
+            if (scaleMilli == 0 || field >= Fields) {
+                return 0;
+            }
+            // 桁あふれは計測値ごとに判定する（係数・単位の組み合わせだけでは拒否しない）
+            uint32_t maxMeasured = 0;
+            for (size_t i = 0; i < count; i++) {
+                const uint32_t raw = rawValue(i, field);
+                maxMeasured        = std::max(maxMeasured, raw <= maxValidValue ? raw : 0);
+            }
+            if (maxMeasured > std::numeric_limits<int64_t>::max() / scaleMilli) {
+                return 0;
+            }
+            size_t valid = 0;
+            // 分岐を持たないループにしてベクトル化しやすくする
+            for (size_t i = 0; i < count; i++) {
+                const uint32_t raw  = rawValue(i, field);
+                const bool measured = raw <= maxValidValue;
+                out[i]              = measured ? raw * scaleMilli : invalidMilliWattHour;
+                valid += measured;
+            }
+            return valid;
+        }
+
+      private:
+        const uint8_t *slots = nullptr;
+        uint8_t count        = 0;
+        float scale          = 1.0f;
+        int64_t scaleMilli   = 0;
+
+        uint32_t rawValue(const uint8_t index, const size_t field) const {
+            return readBigEndian<uint32_t>(slots + index * slotSize + field * sizeof(uint32_t));
+        }
+
+        bool isValidSlot(const uint8_t index) const {
+            for (size_t i = 0; i < Fields; i++) {
+                if (rawValue(index, i) > maxValidValue) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    /// @brief 積算電力量計測値履歴（0xE2・0xE4）
+    struct CumulativeEnergyHistory {
+        uint16_t day;                          ///< 積算履歴収集日（0:当日、1〜99:前日からの日数）
+        CumulativeEnergyHistoryRange<1> slots; ///< 0:00から30分ごとの48コマ
+    };
+
+    /// @brief 積算電力量計測値履歴２・３（0xEC・0xEE）
+    struct CumulativeEnergyHistoryWithDate {
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+        uint8_t hour;
+        uint8_t minute;
+        CumulativeEnergyHistoryRange<2> slots; ///< 収集日時から遡るコマ（正方向、逆方向）
+    };
+
+    /// @brief EPCごとのプロパティ定義
+    template <Property Prop, class = void>
+    struct PropertySchema;
+
+    template <class Dummy>
+    struct PropertySchema<Property::Coefficient, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeEnergyUnit, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeEnergyPositive, Dummy> : EchonetLitePropertyDescriptor<0, true, int32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeEnergyNegative, Dummy> : EchonetLitePropertyDescriptor<0, true, int32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousPower, Dummy> : EchonetLitePropertyDescriptor<0, true, int32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousCurrents, Dummy> : EchonetLitePropertyDescriptor<-1, true, int16_t, int16_t> {};
+
     /// @brief 単位初期化
     bool initCumulativeEnergyUnit(void) {
-        int8_t unit;
-        if (getSpecifiedPropertyData(Property::CumulativeEnergyUnit, &unit) && convertCumulativeEnergyUnit(unit, &this->cumulativeEnergyUnit)) {
+        uint8_t unit;
+        if (get<Property::CumulativeEnergyUnit>(&unit) && convertCumulativeEnergyUnit(unit, &this->cumulativeEnergyUnit)) {
+            convertCumulativeEnergyUnitExponent(unit, &this->cumulativeEnergyUnitExponent);
+            updateCumulativeEnergyScaleMilli();
             return true;
         }
         return false;
@@ -50,8 +254,9 @@ class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceCl
     /// @brief 係数初期化
     bool initSyntheticTransformationRatio(void) {
         uint32_t ratio;
-        if (getSpecifiedPropertyData(Property::Coefficient, &ratio) && ratio <= 999999) {
+        if (get<Property::Coefficient>(&ratio) && ratio >= 1 && ratio <= 999999) {
             this->syntheticTransformationRatio = ratio;
+            updateCumulativeEnergyScaleMilli();
             return true;
         }
         return false;
@@ -78,30 +283,9 @@ class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceCl
         return this->syntheticTransformationRatio;
     }
 
-    /// @brief Get要求リクエストデータ生成
-    template <class PropertyType>
-    void generateGetRequest(const std::vector<PropertyType> &property) {
-        HousingFacilitiesDeviceClass::generateGetRequest(property);
-        data.EDATA.DEOJ.classCode = static_cast<uint8_t>(ClassCode::LowVoltageSmartElectricMeter);
-    }
-
-    /// @brief レスポンスのパース
-    bool load(const std::string &response) {
-        const bool result = HousingFacilitiesDeviceClass::load(response);
-        for (const EchonetLite::EchonetLitePayload &payload : this->data.payload) {
-            // 係数と単位はあらかじめパースしておく
-            switch (static_cast<Property>(payload.echonetLiteProperty)) {
-                case LowVoltageSmartElectricEnergyMeterClass::Property::CumulativeEnergyUnit:
-                    initCumulativeEnergyUnit();
-                    break;
-                case LowVoltageSmartElectricEnergyMeterClass::Property::Coefficient:
-                    initSyntheticTransformationRatio();
-                    break;
-                default:
-                    break;
-            }
-        }
-        return result;
+    /// @brief 積算電力量計測値1あたりの電力量[mWh]取得（係数・単位の積）
+    int64_t getCumulativeEnergyScaleMilli() const {
+        return this->cumulativeEnergyScaleMilli;
     }
 
     /// @brief 積算電力量単位変換
@@ -139,19 +323,52 @@ class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceCl
         }
     }
 
+    /// @brief 積算電力量単位の10の指数[kWh]への変換（0x01:0.1kWh→-1、0x0A:10kWh→1）
+    static bool convertCumulativeEnergyUnitExponent(const uint8_t in, int8_t *const out) {
+        if (in <= 0x04) {
+            *out = -static_cast<int8_t>(in);
+            return true;
+        }
+        if (in >= 0x0A && in <= 0x0D) {
+            *out = in - 0x09;
+            return true;
+        }
+        return false;
+    }
+
     /// @brief 瞬時電力計測値取得
     bool getInstantaneousPower(int32_t *const instantaneousPower) const {
-        return getSpecifiedPropertyData(Property::InstantaneousPower, instantaneousPower);
+        return get<Property::InstantaneousPower>(instantaneousPower);
     }
 
     /// @brief 瞬時電流計測値取得
     bool getInstantaneousCurrent(float *const current_R, float *const current_T) const {
-        int16_t current_R_Int = 0;
-        int16_t current_T_Int = 0;
-        const bool hasData    = getSpecifiedPropertyData(Property::InstantaneousCurrents, &current_R_Int, &current_T_Int);
-        if (getSpecifiedPropertyData(Property::InstantaneousCurrents, &current_R_Int, &current_T_Int)) {
-            *current_R = current_R_Int * 0.1;
-            *current_T = current_T_Int * 0.1;
+        using Schema = PropertySchema<Property::InstantaneousCurrents>;
+        Schema::value_type currents;
+        const bool hasData = get<Property::InstantaneousCurrents>(&currents);
+        if (hasData) {
+            *current_R = std::get<0>(currents) * Schema::scale;
+            *current_T = std::get<1>(currents) * Schema::scale;
+        }
+        return hasData;
+    }
+
+    /// @brief 瞬時電流計測値取得[mA]（整数演算のみ）
+    bool getInstantaneousCurrentMilliAmpere(int32_t *const current_R, int32_t *const current_T) const {
+        using Schema = PropertySchema<Property::InstantaneousCurrents>;
+        static_assert(Schema::scaleExponent >= -3, "current resolution must not be finer than 1mA");
+        constexpr int32_t multiplier = [] {
+            int32_t result = 1;
+            for (int8_t i = -3; i < Schema::scaleExponent; i++) {
+                result *= 10;
+            }
+            return result;
+        }();
+        Schema::value_type currents;
+        const bool hasData = get<Property::InstantaneousCurrents>(&currents);
+        if (hasData) {
+            *current_R = std::get<0>(currents) * multiplier;
+            *current_T = std::get<1>(currents) * multiplier;
         }
         return hasData;
     }
@@ -159,7 +376,7 @@ class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceCl
     /// @brief 積算電力量計測値（正方向）取得
     bool getCumulativeEnergyPositive(float *const cumulativeEnergyPositive) const {
         int32_t cumulativeEnergyPositiveInt = 0;
-        const bool hasData                  = getSpecifiedPropertyData(Property::CumulativeEnergyPositive, &cumulativeEnergyPositiveInt);
+        const bool hasData                  = get<Property::CumulativeEnergyPositive>(&cumulativeEnergyPositiveInt);
         if (hasData) {
             *cumulativeEnergyPositive = cumulativeEnergyPositiveInt * this->syntheticTransformationRatio * this->cumulativeEnergyUnit;
         }
@@ -169,10 +386,101 @@ class LowVoltageSmartElectricEnergyMeterClass : public HousingFacilitiesDeviceCl
     /// @brief 積算電力量計測値（逆方向）取得
     bool getCumulativeEnergyNegative(float *const cumulativeEnergyNegative) const {
         int32_t cumulativeEnergyNegativeInt = 0;
-        const bool hasData                  = getSpecifiedPropertyData(Property::CumulativeEnergyNegative, &cumulativeEnergyNegativeInt);
+        const bool hasData                  = get<Property::CumulativeEnergyNegative>(&cumulativeEnergyNegativeInt);
         if (hasData) {
             *cumulativeEnergyNegative = cumulativeEnergyNegativeInt * this->syntheticTransformationRatio * this->cumulativeEnergyUnit;
         }
         return hasData;
     }
+
+    /// @brief 積算電力量計測値（正方向）取得[mWh]（整数演算のみ）
+    bool getCumulativeEnergyPositiveMilliWattHour(int64_t *const cumulativeEnergyPositive) const {
+        return getCumulativeEnergyMilliWattHour<Property::CumulativeEnergyPositive>(cumulativeEnergyPositive);
+    }
+
+    /// @brief 積算電力量計測値（逆方向）取得[mWh]（整数演算のみ）
+    bool getCumulativeEnergyNegativeMilliWattHour(int64_t *const cumulativeEnergyNegative) const {
+        return getCumulativeEnergyMilliWattHour<Property::CumulativeEnergyNegative>(cumulativeEnergyNegative);
+    }
+
+    /// @brief 積算電力量計測値履歴（正方向）取得
+    bool getCumulativeEnergyHistoryPositive(CumulativeEnergyHistory *const history) const {
+        return getCumulativeEnergyHistory(Property::CumulativeEnergyHistoryPositive, history);
+    }
+
+    /// @brief 積算電力量計測値履歴（逆方向）取得
+    bool getCumulativeEnergyHistoryNegative(CumulativeEnergyHistory *const history) const {
+        return getCumulativeEnergyHistory(Property::CumulativeEnergyHistoryNegative, history);
+    }
+
+    /// @brief 積算電力量計測値履歴２（30分ごと、正方向・逆方向）取得
+    bool getCumulativeEnergyHistory2(CumulativeEnergyHistoryWithDate *const history) const {
+        return getCumulativeEnergyHistory(Property::CumulativeEnergyHistory2, 12, history);
+    }
+
+    /// @brief 積算電力量計測値履歴３（1分ごと、正方向・逆方向）取得
+    bool getCumulativeEnergyHistory3(CumulativeEnergyHistoryWithDate *const history) const {
+        return getCumulativeEnergyHistory(Property::CumulativeEnergyHistory3, 10, history);
+    }
+
+  private:
+    static constexpr size_t cumulativeEnergyHistorySlots = 48;
+
+    /// @brief 係数・単位の積
+    float getCumulativeEnergyScale() const {
+        return this->syntheticTransformationRatio * this->cumulativeEnergyUnit;
+    }
+
+    /// @brief 係数・単位から計測値1あたりの電力量[mWh]を再計算
+    /// @note 係数は999999以下、単位は10^4kWh以下のため、積（最大約10^16）はint64_tに収まる
+    void updateCumulativeEnergyScaleMilli() {
+        // 10^(指数+3)[Wh] = 10^(指数+6)[mWh]、指数は-4〜4
+        constexpr int64_t powersOfTen[]  = {100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 10000000000};
+        this->cumulativeEnergyScaleMilli = static_cast<int64_t>(this->syntheticTransformationRatio) * powersOfTen[this->cumulativeEnergyUnitExponent + 4];
+    }
+
+    /// @return 計測値との積がint64_tに収まらない場合はfalse
+    template <Property Prop>
+    bool getCumulativeEnergyMilliWattHour(int64_t *const out) const {
+        int32_t value;
+        if (!get<Prop>(&value) || value < 0 || static_cast<uint32_t>(value) > CumulativeEnergyHistoryRange<1>::maxValidValue) {
+            return false;
+        }
+        int64_t milliWattHour;
+        if (__builtin_mul_overflow(static_cast<int64_t>(value), this->cumulativeEnergyScaleMilli, &milliWattHour)) {
+            return false;
+        }
+        *out = milliWattHour;
+        return true;
+    }
+
+    bool getCumulativeEnergyHistory(const Property prop, CumulativeEnergyHistory *const history) const {
+        const EchonetLitePayload *const payload = findProperty(static_cast<uint8_t>(prop));
+        if (payload == nullptr || payload->payload.size() != sizeof(uint16_t) + cumulativeEnergyHistorySlots * CumulativeEnergyHistoryRange<1>::slotSize) {
+            return false;
+        }
+        history->day   = readBigEndian<uint16_t>(payload->payload.data());
+        history->slots = CumulativeEnergyHistoryRange<1>(payload->payload.data() + sizeof(uint16_t), cumulativeEnergyHistorySlots, getCumulativeEnergyScale(), this->cumulativeEnergyScaleMilli);
+        return true;
+    }
+
+    bool getCumulativeEnergyHistory(const Property prop, const uint8_t maxSlots, CumulativeEnergyHistoryWithDate *const history) const {
+        constexpr size_t headerSize             = 7; // 収集日時6バイト（年2・月・日・時・分） + 収集コマ数
+        const EchonetLitePayload *const payload = findProperty(static_cast<uint8_t>(prop));
+        if (payload == nullptr || payload->payload.size() < headerSize) {
+            return false;
+        }
+        const uint8_t *const edt = payload->payload.data();
+        const uint8_t count      = edt[6];
+        if (count == 0 || count > maxSlots || payload->payload.size() != headerSize + count * CumulativeEnergyHistoryRange<2>::slotSize) {
+            return false;
+        }
+        history->year   = readBigEndian<uint16_t>(edt);
+        history->month  = edt[2];
+        history->day    = edt[3];
+        history->hour   = edt[4];
+        history->minute = edt[5];
+        history->slots  = CumulativeEnergyHistoryRange<2>(edt + headerSize, count, getCumulativeEnergyScale(), this->cumulativeEnergyScaleMilli);
+        return true;
+    }
 };
\ No newline at end of file
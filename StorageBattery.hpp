@@ -0,0 +1,136 @@
+#pragma once
+
+#include "HousingFacilitiesDevice.hpp"
+
+class StorageBatteryClass : public HousingFacilitiesDevice<StorageBatteryClass, HousingFacilitiesClassCode::StorageBattery> {
+  public:
+    /// @brief 蓄電池クラス
+    /// @version APPENDIX ECHONET 機器オブジェクト詳細規定 Release R
+    enum class Property : uint8_t {
+        ACEffectiveCapacityCharging             = 0xA0, ///< AC実効容量（充電）
+        ACEffectiveCapacityDischarging          = 0xA1, ///< AC実効容量（放電）
+        ACChargeableCapacity                    = 0xA2, ///< AC充電可能容量
+        ACDischargeableCapacity                 = 0xA3, ///< AC放電可能容量
+        ACChargeableElectricEnergy              = 0xA4, ///< AC充電可能量
+        ACDischargeableElectricEnergy           = 0xA5, ///< AC放電可能量
+        ACCumulativeChargingEnergy              = 0xA8, ///< AC積算充電電力量計測値
+        ACCumulativeDischargingEnergy           = 0xA9, ///< AC積算放電電力量計測値
+        ACChargeAmountSetting                   = 0xAA, ///< AC充電量設定値
+        ACDischargeAmountSetting                = 0xAB, ///< AC放電量設定値
+        ChargingMethod                          = 0xC1, ///< 充電方式
+        DischargingMethod                       = 0xC2, ///< 放電方式
+        MinimumMaximumChargingPower             = 0xC8, ///< 最小最大充電電力値
+        MinimumMaximumDischargingPower          = 0xC9, ///< 最小最大放電電力値
+        WorkingOperationStatus                  = 0xCF, ///< 運転動作状態
+        RatedElectricEnergy                     = 0xD0, ///< 定格電力量
+        InstantaneousChargingDischargingPower   = 0xD3, ///< 瞬時充放電電力計測値（充電が正）
+        InstantaneousChargingDischargingCurrent = 0xD4, ///< 瞬時充放電電流計測値（充電が正）
+        InstantaneousChargingDischargingVoltage = 0xD5, ///< 瞬時充放電電圧計測値（充電が正）
+        CumulativeDischargingEnergy             = 0xD6, ///< 積算放電電力量計測値
+        CumulativeChargingEnergy                = 0xD8, ///< 積算充電電力量計測値
+        OperationModeSetting                    = 0xDA, ///< 運転モード設定
+        RemainingStoredElectricity1             = 0xE2, ///< 蓄電残量1
+        RemainingStoredElectricity3             = 0xE4, ///< 蓄電残量3
+        BatteryType                             = 0xE6, ///< 蓄電池タイプ
+        ChargingPowerSetting                    = 0xEB, ///< 充電電力設定値
+        DischargingPowerSetting                 = 0xEC, ///< 放電電力設定値
+    };
+
+    /// @brief 運転モード設定・運転動作状態の値
+    enum class OperationMode : uint8_t {
+        Other                          = 0x40, ///< その他
+        RapidCharging                  = 0x41, ///< 急速充電
+        Charging                       = 0x42, ///< 充電
+        Discharging                    = 0x43, ///< 放電
+        Standby                        = 0x44, ///< 待機
+        Test                           = 0x45, ///< テスト
+        Automatic                      = 0x46, ///< 自動
+        Restart                        = 0x48, ///< 再起動
+        EffectiveCapacityRecalculation = 0x49, ///< 実効容量再計算処理
+    };
+
+    /// @brief EPCごとのプロパティ定義
+    template <Property Prop, class = void>
+    struct PropertySchema;
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACEffectiveCapacityCharging, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACEffectiveCapacityDischarging, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACChargeableCapacity, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACDischargeableCapacity, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACChargeableElectricEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACDischargeableElectricEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACCumulativeChargingEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACCumulativeDischargingEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACChargeAmountSetting, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ACDischargeAmountSetting, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ChargingMethod, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::DischargingMethod, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::MinimumMaximumChargingPower, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::MinimumMaximumDischargingPower, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::WorkingOperationStatus, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RatedElectricEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousChargingDischargingPower, Dummy> : EchonetLitePropertyDescriptor<0, true, int32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousChargingDischargingCurrent, Dummy> : EchonetLitePropertyDescriptor<-1, true, int16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::InstantaneousChargingDischargingVoltage, Dummy> : EchonetLitePropertyDescriptor<0, true, int16_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeDischargingEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::CumulativeChargingEnergy, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::OperationModeSetting, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RemainingStoredElectricity1, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::RemainingStoredElectricity3, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::BatteryType, Dummy> : EchonetLitePropertyDescriptor<0, false, uint8_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::ChargingPowerSetting, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+
+    template <class Dummy>
+    struct PropertySchema<Property::DischargingPowerSetting, Dummy> : EchonetLitePropertyDescriptor<0, true, uint32_t> {};
+};
\ No newline at end of file
@@ -0,0 +1,310 @@
+#include "BasicEchonetLite.hpp"
+#include "LowVoltageSmartElectricEnergyMeter.hpp"
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+
+// フレームあたりのヒープ確保回数・確保量を計測するため全体のoperator new・deleteを置き換える
+// （配列形式・サイズ付き形式も同じ確保・解放関数を通す）
+static std::atomic<size_t> allocationCount;
+static std::atomic<size_t> allocationBytes;
+
+// 置き換えたoperator deleteがインライン展開されると、GCCはoperator newの戻り値をfree()していると
+// 誤検出する（-Wmismatched-new-delete）ため、確保・解放は展開しない関数にまとめる
+__attribute__((noinline)) static void *countedAllocate(const size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) static void countedFree(void *p) noexcept {
+    std::free(p);
+}
+
+void *operator new(size_t size) {
+    return countedAllocate(size);
+}
+
+void *operator new[](size_t size) {
+    return countedAllocate(size);
+}
+
+void operator delete(void *p) noexcept {
+    countedFree(p);
+}
+
+void operator delete[](void *p) noexcept {
+    countedFree(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    countedFree(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+    countedFree(p);
+}
+
+namespace {
+
+using Meter = LowVoltageSmartElectricEnergyMeterClass;
+
+/// @brief 計測区間のヒープ確保をフレームあたりの値としてカウンタに記録
+class AllocationScope {
+  public:
+    explicit AllocationScope(benchmark::State &state, const size_t framesPerIteration = 1)
+        : state(state), framesPerIteration(framesPerIteration), count(allocationCount.load()), bytes(allocationBytes.load()) {}
+
+    ~AllocationScope() {
+        const double frames            = static_cast<double>(state.iterations() * framesPerIteration);
+        state.counters["allocs/frame"] = (allocationCount.load() - count) / frames;
+        state.counters["bytes/frame"]  = (allocationBytes.load() - bytes) / frames;
+        state.SetItemsProcessed(state.iterations() * framesPerIteration);
+    }
+
+  private:
+    benchmark::State &state;
+    size_t framesPerIteration;
+    size_t count;
+    size_t bytes;
+};
+
+std::vector<uint8_t> makeFrame(const uint8_t service, std::initializer_list<std::vector<uint8_t>> properties) {
+    std::vector<uint8_t> frame = {0x10, 0x81, 0x01, 0x00, 0x02, 0x88, 0x01, 0x05, 0xFF, 0x01, service, static_cast<uint8_t>(properties.size())};
+    for (const std::vector<uint8_t> &property : properties) {
+        frame.insert(frame.end(), property.begin(), property.end());
+    }
+    return frame;
+}
+
+/// @brief 瞬時電力計測値のみのGet_Res
+const std::vector<uint8_t> singleFrame = makeFrame(0x72, {{0xE7, 0x04, 0x00, 0x00, 0x01, 0xF4}});
+
+/// @brief 定期取得を想定した複数EPCのGet_Res
+const std::vector<uint8_t> multiFrame = makeFrame(0x72, {
+                                                            {0xD3, 0x04, 0x00, 0x00, 0x00, 0x01},
+                                                            {0xE1, 0x01, 0x01},
+                                                            {0xE0, 0x04, 0x00, 0x01, 0xE2, 0x40},
+                                                            {0xE3, 0x04, 0x00, 0x00, 0x00, 0x10},
+                                                            {0xE7, 0x04, 0x00, 0x00, 0x01, 0xF4},
+                                                            {0xE8, 0x04, 0x00, 0x1E, 0x00, 0x14},
+                                                        });
+
+/// @brief 積算電力量計測値履歴１（0xE2、48コマ）のGet_Res
+const std::vector<uint8_t> historyFrame = [] {
+    std::vector<uint8_t> edt = {0xE2, 0xC2, 0x00, 0x01};
+    for (uint32_t i = 0; i < 48; i++) {
+        const uint32_t value = i == 47 ? 0xFFFFFFFE : 1000 + i * 10;
+        edt.insert(edt.end(), {static_cast<uint8_t>(value >> 24), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value)});
+    }
+    return makeFrame(0x72, {{0xD3, 0x04, 0x00, 0x00, 0x00, 0x01}, {0xE1, 0x01, 0x01}, edt});
+}();
+
+/// @brief Getプロパティマップ（0x9F、ビットマップ形式）のGet_Res
+const std::vector<uint8_t> propertyMapFrame = [] {
+    std::vector<uint8_t> edt(3 + 16, 0);
+    edt[0] = 0x9F;
+    edt[1] = 17;
+    const uint8_t props[] = {0x80, 0x81, 0x82, 0x88, 0x8A, 0x8D, 0x97, 0x98, 0x9D, 0x9E, 0x9F, 0xD3, 0xD7, 0xE0, 0xE1, 0xE2, 0xE5, 0xE7, 0xE8, 0xEA};
+    edt[2]                = std::size(props);
+    for (const uint8_t prop : props) {
+        edt[3 + (prop & 0x0F)] |= 1 << ((prop >> 4) - 8);
+    }
+    return makeFrame(0x72, {edt});
+}();
+
+/// @brief 不正フレームのコーパス（手作りの境界値と正常フレームの決定的な変異）
+const std::vector<std::vector<uint8_t>> malformedCorpus = [] {
+    std::vector<std::vector<uint8_t>> corpus = {
+        {},
+        {0x10},
+        {0x10, 0x81, 0x01, 0x00, 0x02, 0x88, 0x01, 0x05, 0xFF, 0x01, 0x72},
+        makeFrame(0x72, {{0xE7, 0x04}}),
+        makeFrame(0x72, {{0xE7, 0xFF, 0x00}}),
+        {0x10, 0x81, 0x01, 0x00, 0x02, 0x88, 0x01, 0x05, 0xFF, 0x01, 0x72, 0xFF, 0xE7, 0x00},
+        makeFrame(0x72, {{0x9F, 0x11, 0xFF}}),
+        makeFrame(0x72, {{0xE2, 0x02, 0x00, 0x01}}),
+    };
+    uint32_t seed = 0x3610;
+    auto random   = [&seed] {
+        seed = seed * 1664525 + 1013904223;
+        return seed >> 8;
+    };
+    for (const std::vector<uint8_t> *base : {&multiFrame, &historyFrame, &propertyMapFrame}) {
+        for (size_t i = 0; i < 64; i++) {
+            std::vector<uint8_t> mutated = *base;
+            switch (random() % 3) {
+                case 0:
+                    mutated.resize(random() % mutated.size());
+                    break;
+                case 1:
+                    mutated[EchonetLite::minimumFrameSize - 1 + random() % (mutated.size() - EchonetLite::minimumFrameSize + 1)] ^= 1 << (random() % 8);
+                    break;
+                default:
+                    mutated[EchonetLite::minimumFrameSize + 1] = random();
+                    break;
+            }
+            corpus.push_back(std::move(mutated));
+        }
+    }
+    return corpus;
+}();
+
+void BM_FrameView(benchmark::State &state, const std::vector<uint8_t> *frame) {
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        const EchonetLite::EchonetLiteFrameView view = EchonetLite::load(frame->data(), frame->size());
+        benchmark::DoNotOptimize(view);
+    }
+}
+
+void BM_Load(benchmark::State &state, const std::vector<uint8_t> *frame) {
+    Meter meter;
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meter.load(EchonetLite::load(frame->data(), frame->size())));
+    }
+}
+
+void BM_LoadHex(benchmark::State &state, const std::vector<uint8_t> *frame) {
+    std::string hex(frame->size() * 2, '\0');
+    EchonetLite::encodeHex(frame->data(), frame->size(), hex.data(), hex.size());
+    Meter meter;
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meter.load(hex));
+    }
+}
+
+void BM_StaticLoad(benchmark::State &state, const std::vector<uint8_t> *frame) {
+    static BasicEchonetLite<16, 256> packet;
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(packet.load(frame->data(), frame->size()));
+    }
+}
+
+void BM_GetRawData(benchmark::State &state) {
+    Meter meter;
+    meter.generateGetRequest(std::vector<Meter::Property>{Meter::Property::InstantaneousPower, Meter::Property::InstantaneousCurrents, Meter::Property::CumulativeEnergyPositive});
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meter.getRawData());
+    }
+}
+
+void BM_SerializeTo(benchmark::State &state) {
+    Meter meter;
+    meter.generateGetRequest(std::vector<Meter::Property>{Meter::Property::InstantaneousPower, Meter::Property::InstantaneousCurrents, Meter::Property::CumulativeEnergyPositive});
+    uint8_t out[64];
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meter.serializeTo(out, sizeof(out)));
+    }
+}
+
+void BM_GetSpecifiedPropertyData(benchmark::State &state) {
+    Meter meter;
+    meter.load(EchonetLite::load(multiFrame.data(), multiFrame.size()));
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        int32_t power;
+        int16_t currentR;
+        int16_t currentT;
+        benchmark::DoNotOptimize(meter.getSpecifiedPropertyData(Meter::Property::InstantaneousPower, &power));
+        benchmark::DoNotOptimize(meter.getSpecifiedPropertyData(Meter::Property::InstantaneousCurrents, &currentR, &currentT));
+    }
+}
+
+void BM_GetInstantaneousCurrent(benchmark::State &state) {
+    Meter meter;
+    meter.load(EchonetLite::load(multiFrame.data(), multiFrame.size()));
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        float currentR;
+        float currentT;
+        benchmark::DoNotOptimize(meter.getInstantaneousCurrent(&currentR, &currentT));
+    }
+}
+
+void BM_CumulativeEnergyHistory(benchmark::State &state) {
+    Meter meter;
+    meter.load(EchonetLite::load(historyFrame.data(), historyFrame.size()));
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        Meter::CumulativeEnergyHistory history;
+        meter.getCumulativeEnergyHistoryPositive(&history);
+        float total = 0;
+        for (const auto slot : history.slots) {
+            total += slot.energy[0];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+void BM_CumulativeEnergyHistoryConvert(benchmark::State &state) {
+    Meter meter;
+    meter.load(EchonetLite::load(historyFrame.data(), historyFrame.size()));
+    int64_t energy[48];
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        Meter::CumulativeEnergyHistory history;
+        meter.getCumulativeEnergyHistoryPositive(&history);
+        benchmark::DoNotOptimize(history.slots.convert(energy));
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_GetPropertyMapDecoded(benchmark::State &state) {
+    Meter meter;
+    meter.load(EchonetLite::load(propertyMapFrame.data(), propertyMapFrame.size()));
+    std::vector<uint8_t> props;
+    AllocationScope scope(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meter.getPropertyMapDecoded(&props));
+    }
+}
+
+/// @brief 不正フレームのコーパス全体を1反復として読み込む
+void BM_MalformedCorpus(benchmark::State &state) {
+    Meter meter;
+    AllocationScope scope(state, malformedCorpus.size());
+    for (auto _ : state) {
+        for (const std::vector<uint8_t> &frame : malformedCorpus) {
+            meter.load(EchonetLite::load(frame.data(), frame.size()));
+            int32_t power;
+            std::vector<uint8_t> props;
+            benchmark::DoNotOptimize(meter.getInstantaneousPower(&power));
+            benchmark::DoNotOptimize(meter.getPropertyMapDecoded(&props));
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_FrameView, single, &singleFrame);
+BENCHMARK_CAPTURE(BM_FrameView, multi, &multiFrame);
+BENCHMARK_CAPTURE(BM_FrameView, history, &historyFrame);
+BENCHMARK_CAPTURE(BM_Load, single, &singleFrame);
+BENCHMARK_CAPTURE(BM_Load, multi, &multiFrame);
+BENCHMARK_CAPTURE(BM_Load, history, &historyFrame);
+BENCHMARK_CAPTURE(BM_Load, propertyMap, &propertyMapFrame);
+BENCHMARK_CAPTURE(BM_LoadHex, single, &singleFrame);
+BENCHMARK_CAPTURE(BM_LoadHex, multi, &multiFrame);
+BENCHMARK_CAPTURE(BM_StaticLoad, single, &singleFrame);
+BENCHMARK_CAPTURE(BM_StaticLoad, multi, &multiFrame);
+BENCHMARK_CAPTURE(BM_StaticLoad, history, &historyFrame);
+BENCHMARK(BM_GetRawData);
+BENCHMARK(BM_SerializeTo);
+BENCHMARK(BM_GetSpecifiedPropertyData);
+BENCHMARK(BM_GetInstantaneousCurrent);
+BENCHMARK(BM_CumulativeEnergyHistory);
+BENCHMARK(BM_CumulativeEnergyHistoryConvert);
+BENCHMARK(BM_GetPropertyMapDecoded);
+BENCHMARK(BM_MalformedCorpus);
+
+BENCHMARK_MAIN();
\ No newline at end of file
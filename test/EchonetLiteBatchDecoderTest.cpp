@@ -0,0 +1,117 @@
+#include "EchonetLiteBatchDecoder.hpp"
+#include "EchonetLiteTest.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Decoder = EchonetLiteBatchDecoder;
+using Column  = Decoder::Column;
+
+std::string toHex(const std::vector<uint8_t> &bytes) {
+    constexpr char digits[] = "0123456789ABCDEF";
+    std::string hex;
+    for (const uint8_t byte : bytes) {
+        hex += digits[byte >> 4];
+        hex += digits[byte & 0x0F];
+    }
+    return hex;
+}
+
+/// @brief 係数・単位・積算電力量・瞬時電流を含むメータの応答
+std::string makeEnergyLine(const uint16_t transactionId) {
+    return toHex(makeTestFrame(transactionId, testMeter, testController, EchonetLite::EchonetLiteService::Get_Res, {{0xD3, {0x00, 0x00, 0x00, 0x0A}}, {0xE1, {0x01}}, {0xE0, {0x00, 0x00, 0x30, 0x39}}, {0xE8, {0x00, 0x0F, 0xFF, 0xF6}}}));
+}
+
+/// @brief 行形式（タイムスタンプ付き・ERXUDP行）と生値の列
+void testDecodeLine() {
+    Decoder::Result result;
+    const std::string timestamped = "1700000000123 " + makeEnergyLine(0x0001) + "\r";
+    EXPECT(Decoder::decodeLine(timestamped.data(), timestamped.size(), &result));
+    const std::string erxudp = "ERXUDP FE80:0000:0000:0000:0000:0000:0000:0001 FE80:0000:0000:0000:0000:0000:0000:0002 0E1A 0E1A 001D129012345678 1 0012 " + toHex(makeMeterFrame(0x0002));
+    EXPECT(Decoder::decodeLine(erxudp.data(), erxudp.size(), &result));
+    const std::string bare = toHex(makeMeterFrame(0x0003));
+    EXPECT(Decoder::decodeLine(bare.data(), bare.size(), &result));
+
+    EXPECT(result.size() == 3);
+    EXPECT(result.timestamp[0] == 1700000000123ULL && result.timestamp[1] == 0 && result.timestamp[2] == 0);
+    EXPECT(result.transactionId[0] == 0x0001 && result.transactionId[1] == 0x0002);
+    EXPECT(result.sourceObject[0] == 0x028801 && result.service[0] == 0x72);
+    // 積算電力量・単位は係数・単位を適用しない生値
+    EXPECT(result.has(0, Column::CumulativeEnergyPositiveRaw) && result.cumulativeEnergyPositiveRaw[0] == 12345);
+    EXPECT(result.has(0, Column::CumulativeEnergyUnitCode) && result.cumulativeEnergyUnitCode[0] == 0x01);
+    EXPECT(result.has(0, Column::Coefficient) && result.coefficient[0] == 10);
+    EXPECT(result.has(0, Column::InstantaneousCurrents) && result.currentR[0] == 15 && result.currentT[0] == -10);
+    EXPECT(!result.has(0, Column::InstantaneousPower) && !result.has(0, Column::CumulativeEnergyNegativeRaw));
+    EXPECT(result.has(1, Column::InstantaneousPower) && result.instantaneousPower[1] == 256);
+    EXPECT(result.columns[1] == static_cast<uint16_t>(Column::InstantaneousPower));
+
+    // 数字以外を含む・桁あふれするタイムスタンプ、16進でないフレームは不正な行
+    for (const std::string &line : {"12:00:00 " + bare, "17000000001x " + bare, "184467440737095516160 " + bare, std::string("1700000000123 10ZZ81"), std::string("1700000000123 1081")}) {
+        EXPECT(!Decoder::decodeLine(line.data(), line.size(), &result));
+    }
+    EXPECT(result.size() == 3);
+}
+
+/// @brief 行の分割（空行は数えず、末尾の改行がなくてもよい）
+void testDecodeBuffer() {
+    const std::string buffer = "1 " + makeEnergyLine(0x0010) + "\n\n2 " + toHex(makeMeterFrame(0x0011)) + "\r\nbroken\n3 " + toHex(makeMeterFrame(0x0012));
+    const Decoder::Result result = Decoder::decode(buffer.data(), buffer.size());
+    EXPECT(result.size() == 3);
+    EXPECT(result.malformed == 1);
+    EXPECT(result.timestamp[0] == 1 && result.timestamp[1] == 2 && result.timestamp[2] == 3);
+    EXPECT(result.transactionId[2] == 0x0012);
+}
+
+/// @brief 分割数によらず行の順序・結果が一致する
+void testThreaded() {
+    std::string buffer;
+    for (uint16_t i = 0; i < 1000; i++) {
+        buffer += std::to_string(1000 + i) + " " + (i % 3 == 0 ? makeEnergyLine(i) : toHex(makeMeterFrame(i))) + "\n";
+        if (i % 100 == 0) {
+            buffer += "not-a-frame\n";
+        }
+    }
+    const Decoder::Result single = Decoder::decode(buffer.data(), buffer.size());
+    EXPECT(single.size() == 1000 && single.malformed == 10);
+    for (const unsigned threads : {2u, 3u, 7u, 64u}) {
+        const Decoder::Result threaded = Decoder::decode(buffer.data(), buffer.size(), threads);
+        EXPECT(threaded.size() == single.size() && threaded.malformed == single.malformed);
+        EXPECT(threaded.timestamp == single.timestamp);
+        EXPECT(threaded.transactionId == single.transactionId);
+        EXPECT(threaded.columns == single.columns);
+        EXPECT(threaded.cumulativeEnergyPositiveRaw == single.cumulativeEnergyPositiveRaw);
+        EXPECT(threaded.instantaneousPower == single.instantaneousPower);
+    }
+
+    // 行数より分割数が多い・短いバッファ
+    const std::string shortBuffer = "5 " + toHex(makeMeterFrame(0x0005));
+    EXPECT(Decoder::decode(shortBuffer.data(), shortBuffer.size(), 8).size() == 1);
+}
+
+/// @brief ファイルのメモリマップによるデコード
+void testDecodeFile() {
+    char path[] = "/tmp/EchonetLiteBatchDecoderTestXXXXXX";
+    const int fd = mkstemp(path);
+    EXPECT(fd >= 0);
+    const std::string contents = "10 " + makeEnergyLine(0x0020) + "\n20 " + toHex(makeMeterFrame(0x0021)) + "\n";
+    EXPECT(write(fd, contents.data(), contents.size()) == static_cast<ssize_t>(contents.size()));
+    close(fd);
+
+    Decoder::Result result;
+    EXPECT(Decoder::decodeFile(path, &result, 2));
+    EXPECT(result.size() == 2 && result.timestamp[1] == 20 && result.transactionId[1] == 0x0021);
+    unlink(path);
+    EXPECT(!Decoder::decodeFile(path, &result));
+}
+
+} // namespace
+
+int main() {
+    testDecodeLine();
+    testDecodeBuffer();
+    testThreaded();
+    testDecodeFile();
+    return testResult();
+}
@@ -0,0 +1,141 @@
+#include "EchonetLiteTest.hpp"
+#include "ElectricVehicleChargerDischarger.hpp"
+#include "HighVoltageSmartElectricEnergyMeter.hpp"
+#include "HouseholdSolarPowerGeneration.hpp"
+#include "StorageBattery.hpp"
+#include <vector>
+
+namespace {
+
+using ClassGroupCode    = EchonetLite::ClassGroupCode;
+using EchonetLiteObject = EchonetLite::EchonetLiteObject;
+
+static_assert(StorageBatteryClass::classCode == 0x7D);
+static_assert(HouseholdSolarPowerGenerationClass::classCode == 0x79);
+static_assert(ElectricVehicleChargerDischargerClass::classCode == 0x7E);
+static_assert(HighVoltageSmartElectricEnergyMeterClass::classCode == 0x8A);
+static_assert(StorageBatteryClass::isInstance(StorageBatteryClass::eoj(0x02)));
+static_assert(!StorageBatteryClass::isInstance(HouseholdSolarPowerGenerationClass::eoj()));
+static_assert(StorageBatteryClass::PropertySchemaOf<StorageBatteryClass::Property::MinimumMaximumChargingPower>::size == 8);
+static_assert(ElectricVehicleChargerDischargerClass::PropertySchemaOf<ElectricVehicleChargerDischargerClass::Property::InstantaneousChargingDischargingCurrent>::scaleExponent == -1);
+
+/// @brief コントローラ宛てのGet_Res（TID=1）
+std::vector<uint8_t> makeResponse(const EchonetLiteObject &source, const std::vector<TestProperty> &properties) {
+    return makeTestFrame(0x0001, source, testController, EchonetLite::EchonetLiteService::Get_Res, properties);
+}
+
+/// @brief プロパティ定義によるエンコード結果のEDT
+template <class DeviceClass, auto Prop>
+std::vector<uint8_t> encode(const typename DeviceClass::template PropertySchemaOf<Prop>::value_type &value) {
+    std::vector<uint8_t> edt(DeviceClass::template PropertySchemaOf<Prop>::size);
+    EXPECT(DeviceClass::template encode<Prop>(value, edt.data()) == edt.size());
+    return edt;
+}
+
+/// @brief Get要求の宛先がクラスのEOJになること
+template <class DeviceClass>
+bool isRequestTo(const DeviceClass &device) {
+    return DeviceClass::isInstance(device.data.EDATA.DEOJ) && device.data.EDATA.echonetLiteService == EchonetLite::EchonetLiteService::Get;
+}
+
+void testStorageBattery() {
+    using Property = StorageBatteryClass::Property;
+    const std::vector<uint8_t> power = {0xFF, 0xFF, 0xFC, 0x18};
+    const std::vector<uint8_t> range = {0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xA0};
+    EXPECT((encode<StorageBatteryClass, Property::InstantaneousChargingDischargingPower>(-1000) == power));
+    EXPECT((encode<StorageBatteryClass, Property::MinimumMaximumChargingPower>({500, 4000}) == range));
+
+    StorageBatteryClass battery;
+    battery.generateGetRequest<Property::InstantaneousChargingDischargingPower, Property::MinimumMaximumChargingPower, Property::RemainingStoredElectricity3, EchonetLite::Property::OperationStatus>();
+    EXPECT(isRequestTo(battery));
+    const std::vector<uint8_t> response = makeResponse(StorageBatteryClass::eoj(), {{0xD3, power}, {0xC8, range}, {0xE4, {0x55}}, {0x80, {0x30}}});
+    EXPECT(battery.load(EchonetLite::load(response.data(), response.size())));
+
+    int32_t instantaneous = 0;
+    EXPECT(battery.get<Property::InstantaneousChargingDischargingPower>(&instantaneous) && instantaneous == -1000);
+    std::tuple<uint32_t, uint32_t> chargingPower;
+    EXPECT(battery.get<Property::MinimumMaximumChargingPower>(&chargingPower) && chargingPower == std::make_tuple(500U, 4000U));
+    uint8_t remaining = 0;
+    EXPECT(battery.get<Property::RemainingStoredElectricity3>(&remaining) && remaining == 85);
+    uint8_t operationStatus = 0;
+    EXPECT(battery.get<EchonetLite::Property::OperationStatus>(&operationStatus) && operationStatus == 0x30);
+    // 応答に含まれないプロパティ
+    uint32_t rated = 0;
+    EXPECT(!battery.get<Property::RatedElectricEnergy>(&rated));
+}
+
+void testHouseholdSolarPowerGeneration() {
+    using Property = HouseholdSolarPowerGenerationClass::Property;
+    const std::vector<uint8_t> instantaneous = {0x0B, 0xB8};
+    EXPECT((encode<HouseholdSolarPowerGenerationClass, Property::InstantaneousPowerGeneration>(3000) == instantaneous));
+    EXPECT((encode<HouseholdSolarPowerGenerationClass, Property::CumulativePowerGeneration>(123456) == std::vector<uint8_t>{0x00, 0x01, 0xE2, 0x40}));
+
+    HouseholdSolarPowerGenerationClass solar;
+    solar.generateGetRequest<Property::InstantaneousPowerGeneration, Property::CumulativePowerGeneration, Property::CumulativeSoldPower, Property::RatedPowerGenerationSystemInterconnected>();
+    EXPECT(isRequestTo(solar));
+    // 符号なしの値は0を有効とし、0xFFFFFFFF（オーバーフロー）・0xFFFFFFFE（アンダーフロー）を無効とする
+    const std::vector<uint8_t> response = makeResponse(HouseholdSolarPowerGenerationClass::eoj(), {{0xE0, {0x00, 0x00}}, {0xE1, {0xFF, 0xFF, 0xFF, 0xFF}}, {0xE3, {0xFF, 0xFF, 0xFF, 0xFE}}, {0xE8, instantaneous}});
+    EXPECT(solar.load(EchonetLite::load(response.data(), response.size())));
+
+    uint16_t power = 0xFFFF;
+    EXPECT(solar.get<Property::InstantaneousPowerGeneration>(&power) && power == 0);
+    uint32_t cumulative = 0;
+    EXPECT(!solar.get<Property::CumulativePowerGeneration>(&cumulative));
+    EXPECT(!solar.get<Property::CumulativeSoldPower>(&cumulative));
+    uint16_t rated = 0;
+    EXPECT(solar.get<Property::RatedPowerGenerationSystemInterconnected>(&rated) && rated == 3000);
+}
+
+void testElectricVehicleChargerDischarger() {
+    using Property = ElectricVehicleChargerDischargerClass::Property;
+    const std::vector<uint8_t> capacity = {0x00, 0x00, 0x27, 0x10};
+    const std::vector<uint8_t> current  = {0xFF, 0x9C};
+    EXPECT((encode<ElectricVehicleChargerDischargerClass, Property::RemainingBatteryCapacity1>(10000) == capacity));
+    EXPECT((encode<ElectricVehicleChargerDischargerClass, Property::InstantaneousChargingDischargingCurrent>(-100) == current));
+
+    ElectricVehicleChargerDischargerClass charger;
+    charger.generateGetRequest<Property::RemainingBatteryCapacity1, Property::InstantaneousChargingDischargingCurrent, Property::VehicleConnectionStatus>();
+    EXPECT(isRequestTo(charger));
+    const std::vector<uint8_t> response = makeResponse(ElectricVehicleChargerDischargerClass::eoj(), {{0xE2, capacity}, {0xD4, current}, {0xC7, {static_cast<uint8_t>(ElectricVehicleChargerDischargerClass::VehicleConnection::Chargeable)}}});
+    EXPECT(charger.load(EchonetLite::load(response.data(), response.size())));
+
+    uint32_t remaining = 0;
+    EXPECT(charger.get<Property::RemainingBatteryCapacity1>(&remaining) && remaining == 10000);
+    int16_t rawCurrent = 0;
+    EXPECT(charger.get<Property::InstantaneousChargingDischargingCurrent>(&rawCurrent) && rawCurrent == -100);
+    uint8_t connection = 0;
+    EXPECT(charger.get<Property::VehicleConnectionStatus>(&connection) && connection == static_cast<uint8_t>(ElectricVehicleChargerDischargerClass::VehicleConnection::Chargeable));
+}
+
+void testHighVoltageSmartElectricEnergyMeter() {
+    using Property = HighVoltageSmartElectricEnergyMeterClass::Property;
+    const std::vector<uint8_t> coefficient = {0x00, 0x00, 0x00, 0x3C};
+    const std::vector<uint8_t> energy      = {0x00, 0x98, 0x96, 0x80};
+    EXPECT((encode<HighVoltageSmartElectricEnergyMeterClass, Property::Coefficient>(60) == coefficient));
+    EXPECT((encode<HighVoltageSmartElectricEnergyMeterClass, Property::CumulativeActiveEnergy>(10000000) == energy));
+
+    HighVoltageSmartElectricEnergyMeterClass meter;
+    meter.generateGetRequest<Property::Coefficient, Property::CumulativeActiveEnergy, Property::CumulativeActiveEnergyUnit>();
+    EXPECT(isRequestTo(meter));
+    // 別クラス（低圧スマート電力量メータ）からの応答ではない
+    EXPECT(!HighVoltageSmartElectricEnergyMeterClass::isInstance({ClassGroupCode::HousingFacilitiesDeviceClassGroup, 0x88, 0x01}));
+    const std::vector<uint8_t> response = makeResponse(HighVoltageSmartElectricEnergyMeterClass::eoj(), {{0xD3, coefficient}, {0xE0, energy}, {0xE1, {0x02}}});
+    EXPECT(meter.load(EchonetLite::load(response.data(), response.size())));
+
+    uint32_t multiplier = 0;
+    EXPECT(meter.get<Property::Coefficient>(&multiplier) && multiplier == 60);
+    uint32_t cumulative = 0;
+    EXPECT(meter.get<Property::CumulativeActiveEnergy>(&cumulative) && cumulative == 10000000);
+    uint8_t unit = 0;
+    EXPECT(meter.get<Property::CumulativeActiveEnergyUnit>(&unit) && unit == 0x02);
+}
+
+} // namespace
+
+int main() {
+    testStorageBattery();
+    testHouseholdSolarPowerGeneration();
+    testElectricVehicleChargerDischarger();
+    testHighVoltageSmartElectricEnergyMeter();
+    return testResult();
+}
@@ -0,0 +1,132 @@
+#include "EchonetLiteDeviceObject.hpp"
+#include "EchonetLiteTest.hpp"
+#include <vector>
+
+namespace {
+
+using Device  = EchonetLiteDeviceObject<8, 17>;
+using Service = EchonetLite::EchonetLiteService;
+
+/// @brief 動作状態（Get・Set・アナウンス）、運転モード（Get・Set）、残容量（Getのみ）を持つ蓄電池
+Device makeBattery() {
+    Device device(testBattery);
+    const uint8_t on          = 0x30;
+    const uint8_t mode        = 0x44;
+    const uint8_t remaining[] = {0x00, 0x00, 0x03, 0xE8};
+    device.addProperty(0x80, Device::Get | Device::Set | Device::Announce, &on, 1);
+    device.addProperty(0xDA, Device::Get | Device::Set, &mode, 1);
+    device.addProperty(0xE2, Device::Get, remaining, sizeof(remaining));
+    return device;
+}
+
+/// @brief 要求への応答（応答しない場合は空）
+std::vector<uint8_t> respond(Device &device, const std::vector<uint8_t> &request, const size_t capacity = 256) {
+    std::vector<uint8_t> response(capacity);
+    response.resize(device.handle(request.data(), request.size(), response.data(), response.size()));
+    return response;
+}
+
+uint8_t valueOf(const Device &device, const uint8_t prop) {
+    EchonetLite::EchonetLitePropertyView value;
+    return device.getPropertyValue(prop, &value) && value.propertyDataCounter == 1 ? value.payload[0] : 0;
+}
+
+/// @brief プロパティマップ（0x9D・0x9E・0x9F）を登録内容から生成する
+void testPropertyMaps() {
+    Device device = makeBattery();
+    const std::vector<uint8_t> response = respond(device, makeTestFrame(0x0001, testController, testBattery, Service::Get, {{0x9D, {}}, {0x9E, {}}, {0x9F, {}}}));
+    EXPECT((response == makeTestFrame(0x0001, testBattery, testController, Service::Get_Res, {{0x9D, {0x01, 0x80}}, {0x9E, {0x02, 0x80, 0xDA}}, {0x9F, {0x06, 0x9D, 0x9E, 0x9F, 0x80, 0xDA, 0xE2}}})));
+
+    // プロパティマップ自体は登録・更新できない
+    const uint8_t map[] = {0x00};
+    EXPECT(!device.addProperty(0x9F, Device::Get, map, sizeof(map)));
+    EXPECT(!device.setPropertyValue(0x9E, map, sizeof(map)));
+
+    // 16個以上はビットマップ形式
+    uint8_t out[17];
+    const uint8_t props[] = {0x80, 0x81, 0x82, 0x83, 0x88, 0x8A, 0x9D, 0x9E, 0x9F, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0, 0xFF};
+    EXPECT(Device::encodePropertyMap(props, std::size(props), out) == 17);
+    std::vector<uint8_t> decoded;
+    EXPECT(EchonetLite::decodePropertyMap(out, sizeof(out), &decoded));
+    EXPECT(decoded.size() == std::size(props));
+    for (const uint8_t prop : props) {
+        EXPECT(std::find(decoded.begin(), decoded.end(), prop) != decoded.end());
+    }
+}
+
+/// @brief Get・INF_REQへの応答（Get不可のEPCはPDC=0で不可応答）
+void testGet() {
+    Device device = makeBattery();
+    EXPECT((respond(device, makeTestFrame(0x0002, testController, testBattery, Service::Get, {{0x80, {}}, {0xE2, {}}})) == makeTestFrame(0x0002, testBattery, testController, Service::Get_Res, {{0x80, {0x30}}, {0xE2, {0x00, 0x00, 0x03, 0xE8}}})));
+    EXPECT((respond(device, makeTestFrame(0x0003, testController, testBattery, Service::Get, {{0x80, {}}, {0xE7, {}}})) == makeTestFrame(0x0003, testBattery, testController, Service::Get_SNA, {{0x80, {0x30}}, {0xE7, {}}})));
+    EXPECT((respond(device, makeTestFrame(0x0004, testController, testBattery, Service::INF_REQ, {{0x80, {}}})) == makeTestFrame(0x0004, testBattery, testController, Service::INF, {{0x80, {0x30}}})));
+
+    // 全インスタンス宛は応答し、別のオブジェクト宛は応答しない
+    EchonetLite::EchonetLiteObject all = testBattery;
+    all.instanceCode                   = 0x00;
+    EXPECT(!respond(device, makeTestFrame(0x0005, testController, all, Service::Get, {{0x80, {}}})).empty());
+    EXPECT(respond(device, makeTestFrame(0x0006, testController, testMeter, Service::Get, {{0x80, {}}})).empty());
+}
+
+/// @brief SetC・SetIの受理・不可応答と値の反映
+void testSet() {
+    Device device = makeBattery();
+    EXPECT((respond(device, makeTestFrame(0x0010, testController, testBattery, Service::SetC, {{0x80, {0x31}}})) == makeTestFrame(0x0010, testBattery, testController, Service::Set_Res, {{0x80, {}}})));
+    EXPECT(valueOf(device, 0x80) == 0x31);
+
+    // Set不可のEPCはEDTをそのまま返し、受理したEPCは反映する
+    EXPECT((respond(device, makeTestFrame(0x0011, testController, testBattery, Service::SetC, {{0xDA, {0x42}}, {0xE2, {0x00, 0x00, 0x00, 0x00}}})) == makeTestFrame(0x0011, testBattery, testController, Service::SetC_SNA, {{0xDA, {}}, {0xE2, {0x00, 0x00, 0x00, 0x00}}})));
+    EXPECT(valueOf(device, 0xDA) == 0x42);
+
+    // SetIは受理時に応答しない
+    EXPECT(respond(device, makeTestFrame(0x0012, testController, testBattery, Service::SetI, {{0x80, {0x30}}})).empty());
+    EXPECT(valueOf(device, 0x80) == 0x30);
+    EXPECT((respond(device, makeTestFrame(0x0013, testController, testBattery, Service::SetI, {{0x80, {}}})) == makeTestFrame(0x0013, testBattery, testController, Service::SetI_SNA, {{0x80, {}}})));
+
+    // 受理判定で拒否した値は反映しない
+    device.setSetValidator([](const EchonetLite::EchonetLitePropertyView &property) { return property.echonetLiteProperty != 0xDA || property.payload[0] != 0x47; });
+    EXPECT((respond(device, makeTestFrame(0x0014, testController, testBattery, Service::SetC, {{0xDA, {0x47}}})) == makeTestFrame(0x0014, testBattery, testController, Service::SetC_SNA, {{0xDA, {0x47}}})));
+    EXPECT(valueOf(device, 0xDA) == 0x42);
+}
+
+/// @brief 応答がバッファに収まらない場合は応答せず、値も反映しない
+void testSetOverflow() {
+    Device device                      = makeBattery();
+    const std::vector<uint8_t> request = makeTestFrame(0x0020, testController, testBattery, Service::SetC, {{0x80, {0x31}}, {0xDA, {0x42}}});
+    const size_t required              = EchonetLite::minimumFrameSize + 4;
+    EXPECT(respond(device, request, required - 1).empty());
+    EXPECT(valueOf(device, 0x80) == 0x30 && valueOf(device, 0xDA) == 0x44);
+    EXPECT(respond(device, request, required).size() == required);
+    EXPECT(valueOf(device, 0x80) == 0x31 && valueOf(device, 0xDA) == 0x42);
+
+    const std::vector<uint8_t> setGet = makeTestFrameRaw(0x0021, testController, testBattery, Service::SetGet, encodeTestSetGetProperties({{0x80, {0x30}}}, {{0xE2, {}}}));
+    EXPECT(respond(device, setGet, EchonetLite::minimumFrameSize + 2 + 1 + 5).empty());
+    EXPECT(valueOf(device, 0x80) == 0x31);
+}
+
+/// @brief SetGetはSet部を反映した後の値でGet部に応答する
+void testSetGet() {
+    Device device                      = makeBattery();
+    const std::vector<uint8_t> request = makeTestFrameRaw(0x0030, testController, testBattery, Service::SetGet, encodeTestSetGetProperties({{0xDA, {0x42}}}, {{0xDA, {}}, {0xE2, {}}}));
+    EXPECT((respond(device, request) == makeTestFrameRaw(0x0030, testBattery, testController, Service::SetGet_Res, encodeTestSetGetProperties({{0xDA, {}}}, {{0xDA, {0x42}}, {0xE2, {0x00, 0x00, 0x03, 0xE8}}}))));
+    EXPECT(valueOf(device, 0xDA) == 0x42);
+
+    // Set部の不可はGet部を反映前の値で応答する
+    const std::vector<uint8_t> rejected = makeTestFrameRaw(0x0031, testController, testBattery, Service::SetGet, encodeTestSetGetProperties({{0xE2, {0x00, 0x00, 0x00, 0x00}}}, {{0xE2, {}}, {0xE7, {}}}));
+    EXPECT((respond(device, rejected) == makeTestFrameRaw(0x0031, testBattery, testController, Service::SetGet_SNA, encodeTestSetGetProperties({{0xE2, {0x00, 0x00, 0x00, 0x00}}}, {{0xE2, {0x00, 0x00, 0x03, 0xE8}}, {0xE7, {}}}))));
+
+    // Get部が欠けた要求には応答しない
+    EXPECT(respond(device, makeTestFrame(0x0032, testController, testBattery, Service::SetGet, {{0xDA, {0x41}}})).empty());
+    EXPECT(valueOf(device, 0xDA) == 0x42);
+}
+
+} // namespace
+
+int main() {
+    testPropertyMaps();
+    testGet();
+    testSet();
+    testSetOverflow();
+    testSetGet();
+    return testResult();
+}
@@ -0,0 +1,130 @@
+#include "EchonetLiteDiscovery.hpp"
+#include "EchonetLiteTest.hpp"
+#include <vector>
+
+namespace {
+
+using Discovery   = EchonetLiteDiscovery;
+using NodeAddress = Discovery::NodeAddress;
+using Service     = EchonetLite::EchonetLiteService;
+
+/// @brief 送信したフレームの記録
+struct SentFrame {
+    NodeAddress address;
+    std::vector<uint8_t> frame;
+};
+
+NodeAddress nodeAddress(const uint8_t host) {
+    NodeAddress address;
+    address.bytes[10] = 0xFF;
+    address.bytes[11] = 0xFF;
+    address.bytes[12] = 192;
+    address.bytes[13] = 168;
+    address.bytes[15] = host;
+    return address;
+}
+
+std::vector<uint8_t> requestedProperties(const std::vector<uint8_t> &frame) {
+    std::vector<uint8_t> props;
+    for (const EchonetLite::EchonetLitePropertyView &property : EchonetLite::load(frame.data(), frame.size())) {
+        props.push_back(property.echonetLiteProperty);
+    }
+    return props;
+}
+
+/// @brief インスタンスリスト（インスタンス数 + EOJ×n）のEDT
+std::vector<uint8_t> instanceList(const std::vector<EchonetLite::EchonetLiteObject> &objects) {
+    std::vector<uint8_t> edt = {static_cast<uint8_t>(objects.size())};
+    for (const EchonetLite::EchonetLiteObject &object : objects) {
+        edt.insert(edt.end(), {static_cast<uint8_t>(object.classGroupCode), object.classCode, object.instanceCode});
+    }
+    return edt;
+}
+
+/// @brief 探索要求・インスタンスリストの登録・プロパティマップの取得
+void testDiscover() {
+    EchonetLiteNodeRegistry registry;
+    Discovery discovery(registry);
+    discovery.maxInFlight = 1;
+
+    std::vector<std::vector<uint8_t>> multicast;
+    EXPECT(discovery.start(0, [&multicast](const uint8_t *frame, size_t length) {
+        multicast.emplace_back(frame, frame + length);
+        return true;
+    }));
+    EXPECT(discovery.isSearching() && !discovery.isComplete());
+    EXPECT(multicast.size() == 1);
+    const EchonetLite::EchonetLiteFrameView request = EchonetLite::load(multicast[0].data(), multicast[0].size());
+    EXPECT(request.valid && request.EDATA.echonetLiteService == Service::Get);
+    EXPECT(request.EDATA.DEOJ.classGroupCode == Discovery::nodeProfile.classGroupCode && request.EDATA.DEOJ.classCode == Discovery::nodeProfile.classCode);
+    EXPECT((requestedProperties(multicast[0]) == std::vector<uint8_t>{0xD6}));
+
+    // 自ノードインスタンスリストSの応答（重複して受信しても予約は1回）
+    const NodeAddress address        = nodeAddress(10);
+    const std::vector<uint8_t> reply = makeTestResponse(multicast[0], Service::Get_Res, {{0xD6, instanceList({testMeter, testBattery})}});
+    EXPECT(discovery.receive(address, EchonetLite::load(reply.data(), reply.size()), 10) == 2);
+    EXPECT(discovery.receive(address, EchonetLite::load(reply.data(), reply.size()), 20) == 0);
+    EXPECT(registry.find(address, testMeter) != nullptr && registry.find(address, testBattery) != nullptr);
+
+    // 応答待ちは1要求まで
+    std::vector<SentFrame> sent;
+    const EchonetLiteNodeRegistry::Sender sender = [&sent](const NodeAddress &to, const uint8_t *frame, size_t length) {
+        sent.push_back({to, std::vector<uint8_t>(frame, frame + length)});
+        return true;
+    };
+    EXPECT(discovery.poll(100, sender) == 1);
+    EXPECT(discovery.poll(200, sender) == 0);
+    EXPECT(sent[0].address == address);
+    EXPECT((requestedProperties(sent[0].frame) == std::vector<uint8_t>{0x9D, 0x9E, 0x9F}));
+    const EchonetLite::EchonetLiteFrameView probe = EchonetLite::load(sent[0].frame.data(), sent[0].frame.size());
+    EXPECT(probe.EDATA.DEOJ.classCode == testMeter.classCode && probe.EDATA.DEOJ.instanceCode == testMeter.instanceCode);
+
+    // Getプロパティマップを受信した要求は完了とし、次の要求を送る
+    const std::vector<uint8_t> maps = makeTestResponse(sent[0].frame, Service::Get_Res, {{0x9D, {0x01, 0x80}}, {0x9E, {0x00}}, {0x9F, {0x02, 0x80, 0xE7}}});
+    EXPECT(discovery.receive(address, EchonetLite::load(maps.data(), maps.size()), 300) == 0);
+    EXPECT(registry.find(address, testMeter)->hasPropertyMap);
+    EXPECT(discovery.poll(400, sender) == 1);
+    EXPECT(EchonetLite::load(sent[1].frame.data(), sent[1].frame.size()).EDATA.DEOJ.classCode == testBattery.classCode);
+
+    // 応答がなければ応答待ち時間ごとに再送し、再送回数を超えたら諦める
+    EXPECT(discovery.poll(400 + discovery.requestTimeout - 1, sender) == 0);
+    EXPECT(discovery.poll(400 + discovery.requestTimeout, sender) == 1);
+    EXPECT(discovery.poll(400 + discovery.requestTimeout * 2, sender) == 1);
+    EXPECT(!discovery.isSearching() && !discovery.isComplete());
+    EXPECT(discovery.poll(400 + discovery.requestTimeout * 3, sender) == 0);
+    EXPECT(sent.size() == 4 && sent[3].frame.size() == sent[1].frame.size());
+    EXPECT(!discovery.isSearching() && discovery.isComplete());
+    EXPECT(!registry.find(address, testBattery)->hasPropertyMap);
+}
+
+/// @brief インスタンスリスト通知（INF）からの登録と、取得済みオブジェクトの再予約防止
+void testNotification() {
+    EchonetLiteNodeRegistry registry;
+    Discovery discovery(registry);
+    const NodeAddress address = nodeAddress(20);
+
+    // プロパティマップ取得済みのメータは予約しない。インスタンス数はEDTの長さで制限する
+    const std::vector<uint8_t> maps = makeTestFrame(0x0001, testMeter, testController, Service::Get_Res, {{0x9F, {0x01, 0x80}}});
+    EXPECT(registry.receive(address, EchonetLite::load(maps.data(), maps.size()), 0) == 0);
+    std::vector<uint8_t> list = instanceList({testMeter, testBattery});
+    list[0]                   = 5;
+    const std::vector<uint8_t> notification = makeTestFrame(0x0000, Discovery::nodeProfile, testController, Service::INF, {{0xD5, list}});
+    EXPECT(discovery.receive(address, EchonetLite::load(notification.data(), notification.size()), 10) == 1);
+
+    // ノードプロファイル以外からのリストは無視する
+    const std::vector<uint8_t> other = makeTestFrame(0x0000, testMeter, testController, Service::INF, {{0xD5, instanceList({testController})}});
+    EXPECT(discovery.receive(address, EchonetLite::load(other.data(), other.size()), 20) == 0);
+    EXPECT(registry.find(address, testController) == nullptr);
+
+    const uint8_t truncated[] = {0x10, 0x81, 0x00};
+    EXPECT(discovery.receive(address, EchonetLite::load(truncated, sizeof(truncated)), 30) == 0);
+    EXPECT(!discovery.isSearching() && !discovery.isComplete());
+}
+
+} // namespace
+
+int main() {
+    testDiscover();
+    testNotification();
+    return testResult();
+}
@@ -0,0 +1,96 @@
+#include "EchonetLiteFrameRing.hpp"
+#include "EchonetLiteTest.hpp"
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// @brief 空・満杯・破棄数（単一タスク）
+void testBoundaries() {
+    EchonetLiteFrameRing<4, 32> ring;
+    // 空
+    EXPECT(ring.empty());
+    EXPECT(!ring.front().valid);
+    EXPECT(!ring.pop());
+    size_t length = 0;
+    EXPECT(ring.frontBytes(&length) == nullptr);
+
+    // 満杯まで追加し、以降は破棄数に数える
+    for (uint16_t i = 0; i < 4; i++) {
+        const std::vector<uint8_t> frame = makeMeterFrame(i);
+        EXPECT(ring.push(frame.data(), frame.size()));
+    }
+    EXPECT(ring.size() == 4);
+    const std::vector<uint8_t> overflow = makeMeterFrame(4);
+    EXPECT(!ring.push(overflow.data(), overflow.size()));
+    EXPECT(ring.beginWrite() == nullptr);
+    EXPECT(ring.dropped() == 2);
+
+    // 長すぎるフレーム・不正なhexも破棄数に数える
+    EXPECT(ring.pop());
+    const std::vector<uint8_t> oversized(33, 0x00);
+    EXPECT(!ring.push(oversized.data(), oversized.size()));
+    EXPECT(!ring.pushHex("10ZZ81", 6));
+    EXPECT(ring.dropped() == 4);
+    EXPECT(ring.size() == 3);
+
+    // ERXUDPの行末（CRLF）は破棄数に数えずに取り除く
+    const char line[] = "1081040002880105FF017201E70400000100\r\n";
+    EXPECT(ring.pushHex(line, sizeof(line) - 1));
+    EXPECT(ring.dropped() == 4);
+    EXPECT(ring.size() == 4);
+
+    // 先頭から順に取り出せる
+    for (uint16_t i = 1; i < 5; i++) {
+        const EchonetLite::EchonetLiteFrameView frame = ring.front();
+        EXPECT(frame.valid);
+        EXPECT(frame.EHEAD.TransactionId == i);
+        EXPECT(ring.pop());
+    }
+    EXPECT(ring.empty());
+    EXPECT(!ring.pop());
+}
+
+/// @brief 生産者・消費者スレッド間で順序どおり受け渡し、位置の折り返しをまたいでも欠落しないこと
+void testProducerConsumer() {
+    constexpr uint32_t frameCount = 100000;
+    static EchonetLiteFrameRing<8, 32> ring;
+
+    std::thread producer([] {
+        for (uint32_t i = 0; i < frameCount;) {
+            const std::vector<uint8_t> frame = makeMeterFrame(static_cast<uint16_t>(i));
+            if (ring.push(frame.data(), frame.size())) {
+                i++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t received   = 0;
+    uint32_t outOfOrder = 0;
+    while (received < frameCount) {
+        const EchonetLite::EchonetLiteFrameView frame = ring.front();
+        if (!frame.valid) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (frame.EHEAD.TransactionId != static_cast<uint16_t>(received) || frame.propertyCount != 1) {
+            outOfOrder++;
+        }
+        EXPECT(ring.pop());
+        received++;
+    }
+    producer.join();
+
+    EXPECT(outOfOrder == 0);
+    EXPECT(ring.empty());
+}
+
+} // namespace
+
+int main() {
+    testBoundaries();
+    testProducerConsumer();
+    return testResult();
+}
@@ -0,0 +1,211 @@
+#include "BasicEchonetLite.hpp"
+#include "EchonetLiteTest.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+
+using FrameView = EchonetLite::EchonetLiteFrameView;
+using Property  = EchonetLite::EchonetLitePropertyView;
+using Service   = EchonetLite::EchonetLiteService;
+
+FrameView view(const std::vector<uint8_t> &frame) {
+    return EchonetLite::load(frame.data(), frame.size());
+}
+
+std::string toHex(const std::vector<uint8_t> &bytes) {
+    std::string hex(bytes.size() * 2, '\0');
+    EXPECT(EchonetLite::encodeHex(bytes.data(), bytes.size(), hex.data(), hex.size()) == hex.size());
+    return hex;
+}
+
+/// @brief serializeTo()・serializeHexTo()の出力が期待するフレームと一致し、1バイトでも足りなければ0を返す
+template <class Packet>
+void expectSerialized(const Packet &packet, const std::vector<uint8_t> &expected) {
+    EXPECT(packet.size() == expected.size());
+    std::vector<uint8_t> out(expected.size() + 4, 0xEE);
+    EXPECT(packet.serializeTo(out.data(), out.size()) == expected.size());
+    EXPECT(std::equal(expected.begin(), expected.end(), out.begin()));
+    for (size_t cap = 0; cap < expected.size(); cap++) {
+        EXPECT(packet.serializeTo(out.data(), cap) == 0);
+    }
+
+    const std::string hex = toHex(expected);
+    std::string hexOut(hex.size(), ' ');
+    EXPECT(packet.serializeHexTo(hexOut.data(), hexOut.size()) == hex.size());
+    EXPECT(hexOut == hex);
+    for (size_t cap = 0; cap < hex.size(); cap++) {
+        EXPECT(packet.serializeHexTo(hexOut.data(), cap) == 0);
+    }
+}
+
+/// @brief ヘッダ・プロパティ列の解析
+void testParse() {
+    const std::vector<uint8_t> frame = makeTestFrame(0x1234, testMeter, testController, Service::Get_Res, {{0x80, {0x30}}, {0xE7, {0x00, 0x00, 0x01, 0x00}}, {0x9F, {}}});
+    const FrameView parsed           = view(frame);
+    EXPECT(parsed.valid && !parsed.truncated);
+    EXPECT(parsed.EHEAD.head1 == EchonetLite::EchonetLiteHeader1::NewEchonetLite && parsed.EHEAD.head2 == EchonetLite::EchonetLiteHeader2::Type1);
+    EXPECT(parsed.EHEAD.TransactionId == 0x1234);
+    EXPECT(parsed.EDATA.SEOJ.classGroupCode == testMeter.classGroupCode && parsed.EDATA.SEOJ.classCode == 0x88 && parsed.EDATA.SEOJ.instanceCode == 0x01);
+    EXPECT(parsed.EDATA.DEOJ.classCode == 0xFF && parsed.EDATA.echonetLiteService == Service::Get_Res);
+    EXPECT(parsed.EDATA.operationPropertyCounter == 3 && parsed.propertyCount == 3);
+    // EDTは受信バッファを参照する
+    EXPECT(parsed.properties == frame.data() + EchonetLite::minimumFrameSize);
+
+    std::vector<uint8_t> epcs;
+    for (const Property property : parsed) {
+        epcs.push_back(property.echonetLiteProperty);
+    }
+    EXPECT((epcs == std::vector<uint8_t>{0x80, 0xE7, 0x9F}));
+    Property property;
+    EXPECT(parsed.find(0xE7, &property) && property.propertyDataCounter == 4 && property.payload == frame.data() + 17 && property.payload[2] == 0x01);
+    EXPECT(parsed.find(0x9F, &property) && property.propertyDataCounter == 0);
+    EXPECT(!parsed.find(0xE8, &property));
+
+    // OPC=0は有効
+    const FrameView empty = view(makeTestFrame(0x0001, testController, testMeter, Service::Get, {}));
+    EXPECT(empty.valid && !empty.truncated && empty.propertyCount == 0 && empty.begin() == empty.end());
+}
+
+/// @brief ヘッダ長に満たないフレーム・OPC分のプロパティがないフレーム
+void testTruncated() {
+    const std::vector<uint8_t> frame = makeTestFrame(0x0001, testMeter, testController, Service::Get_Res, {{0x80, {0x30}}, {0xE7, {0x00, 0x00, 0x01, 0x00}}});
+    EXPECT(!EchonetLite::load(nullptr, 0).valid);
+    EXPECT(!EchonetLite::load(frame.data(), EchonetLite::minimumFrameSize - 1).valid);
+
+    // 2番目のEDTが欠けている：完全なプロパティのみ列挙する
+    for (size_t length = EchonetLite::minimumFrameSize; length < frame.size(); length++) {
+        const FrameView parsed = EchonetLite::load(frame.data(), length);
+        EXPECT(parsed.valid && parsed.truncated);
+        EXPECT(parsed.propertyCount == (length >= EchonetLite::minimumFrameSize + 3 ? 1 : 0));
+        size_t count = 0;
+        for (const Property property : parsed) {
+            EXPECT(property.payload + property.propertyDataCounter <= frame.data() + length);
+            count++;
+        }
+        EXPECT(count == parsed.propertyCount);
+    }
+
+    // OPCが実際のプロパティ数より多い
+    std::vector<uint8_t> overCounted = frame;
+    overCounted[11]                  = 3;
+    const FrameView parsed           = view(overCounted);
+    EXPECT(parsed.valid && parsed.truncated && parsed.propertyCount == 2);
+
+    // PDCがフレーム末尾を超える
+    std::vector<uint8_t> overLength               = frame;
+    overLength[EchonetLite::minimumFrameSize + 1] = 0xFF;
+    EXPECT(view(overLength).truncated && view(overLength).propertyCount == 0);
+}
+
+/// @brief 16進文字列のデコード
+void testHex() {
+    uint8_t out[4] = {};
+    EXPECT(EchonetLite::decodeHex("10810aFF", 8, out, sizeof(out)) == 4);
+    EXPECT(out[0] == 0x10 && out[1] == 0x81 && out[2] == 0x0A && out[3] == 0xFF);
+    // 奇数長の末尾1文字は無視する
+    EXPECT(EchonetLite::decodeHex("10810", 5, out, sizeof(out)) == 2);
+    EXPECT(EchonetLite::decodeHex("10G1", 4, out, sizeof(out)) == 0);
+    EXPECT(EchonetLite::decodeHex("1081 0", 6, out, sizeof(out)) == 0);
+    EXPECT(EchonetLite::decodeHex("1081020304", 10, out, sizeof(out)) == 0);
+    EXPECT(EchonetLite::trimHexLength("1081\r\n", 6) == 4);
+    EXPECT(EchonetLite::trimHexLength("\r\n", 2) == 0);
+    EXPECT(EchonetLite::trimHexLength("10 81", 5) == 5);
+}
+
+/// @brief 16進文字列の取り込み（末尾の改行を無視し、不正な文字列は取り込まない）
+void testLoadHex() {
+    EchonetLite echonetLite;
+    echonetLite.generateGetRequest(std::vector<EchonetLite::Property>{EchonetLite::Property::OperationStatus});
+    const std::string hex = "1081" "0100" "028801" "05FF01" "72" "01" "800130" "\r\n";
+    EXPECT(echonetLite.load(hex));
+    uint8_t status = 0;
+    EXPECT(echonetLite.getOperationStatus(&status) && status == 0x30);
+
+    EXPECT(!echonetLite.load(std::string("1081ZZ00028801")));
+    EXPECT(echonetLite.data.payload.empty() && !echonetLite.getOperationStatus(&status));
+    EXPECT(!echonetLite.load(std::string("108101")));
+
+    // TIDが要求と異なる応答は取り込むがfalseを返す
+    const std::string other = "1081" "0200" "028801" "05FF01" "72" "01" "800131";
+    EXPECT(!echonetLite.load(other));
+    EXPECT(echonetLite.getOperationStatus(&status) && status == 0x31);
+}
+
+/// @brief Get要求・取り込んだ応答の直列化（EchonetLite・BasicEchonetLite）
+void testSerialize() {
+    const uint8_t props[] = {0x80, 0xE7};
+    EchonetLite echonetLite;
+    echonetLite.generateGetRequest(props, std::size(props));
+    echonetLite.data.EDATA.DEOJ = testMeter;
+    expectSerialized(echonetLite, makeTestFrame(0x0001, testController, testMeter, Service::Get, {{0x80, {}}, {0xE7, {}}}));
+
+    BasicEchonetLite<4, 64> packet;
+    EXPECT(packet.generateGetRequest(props, std::size(props)));
+    packet.data.EDATA.DEOJ = testMeter;
+    expectSerialized(packet, makeTestFrame(0x0001, testController, testMeter, Service::Get, {{0x80, {}}, {0xE7, {}}}));
+
+    // 取り込んだ応答は同じバイト列に戻る
+    const std::vector<uint8_t> response = makeTestFrame(0x0001, testMeter, testController, Service::Get_Res, {{0x80, {0x30}}, {0x9F, {}}, {0xE7, {0x00, 0x00, 0x01, 0x00}}});
+    EXPECT(echonetLite.load(view(response)));
+    expectSerialized(echonetLite, response);
+    EXPECT(echonetLite.getRawData() == response);
+    EXPECT(packet.load(response.data(), response.size()));
+    expectSerialized(packet, response);
+    EXPECT(packet.load(toHex(response) + "\r\n"));
+    expectSerialized(packet, response);
+}
+
+/// @brief EPC索引（同一EPCは先頭を優先し、次のフレームを取り込むと前のEPCは消える）
+void testPropertyIndex() {
+    const std::vector<uint8_t> first  = makeTestFrame(0x0000, testMeter, testController, Service::Get_Res, {{0x80, {0x30}}, {0xE7, {0x00, 0x00, 0x01, 0x00}}, {0x80, {0x31}}});
+    const std::vector<uint8_t> second = makeTestFrame(0x0000, testMeter, testController, Service::Get_Res, {{0xE8, {0x00, 0x0A, 0x00, 0x14}}});
+
+    EchonetLite echonetLite;
+    EXPECT(echonetLite.load(view(first)));
+    const EchonetLite::EchonetLitePayload *payload = echonetLite.findProperty(0x80);
+    EXPECT(payload == &echonetLite.data.payload[0] && payload->payload[0] == 0x30);
+    EXPECT(echonetLite.findProperty(0xE7) == &echonetLite.data.payload[1]);
+    EXPECT(echonetLite.propertyIndex[0xE7] == 2 && echonetLite.propertyIndex[0xE8] == 0);
+    uint8_t status = 0;
+    EXPECT(echonetLite.getSpecifiedPropertyData(EchonetLite::Property::OperationStatus, &status) && status == 0x30);
+    uint16_t wrongSize = 0;
+    EXPECT(!echonetLite.getSpecifiedPropertyData(EchonetLite::Property::OperationStatus, &wrongSize));
+
+    EXPECT(echonetLite.load(view(second)));
+    EXPECT(echonetLite.findProperty(0x80) == nullptr && echonetLite.findProperty(0xE7) == nullptr);
+    EXPECT(echonetLite.findProperty(0xE8) == &echonetLite.data.payload[0]);
+    EXPECT(std::count_if(echonetLite.propertyIndex.begin(), echonetLite.propertyIndex.end(), [](const uint8_t index) { return index != 0; }) == 1);
+
+    // data.payloadを直接編集した場合は再構築する
+    echonetLite.data.payload.push_back({.echonetLiteProperty = 0x80, .propertyDataCounter = 1, .payload = {0x30}});
+    EXPECT(echonetLite.findProperty(0x80) == nullptr);
+    echonetLite.indexProperties();
+    EXPECT(echonetLite.findProperty(0x80) == &echonetLite.data.payload[1]);
+    echonetLite.format();
+    EXPECT(echonetLite.findProperty(0x80) == nullptr && echonetLite.findProperty(0xE8) == nullptr);
+
+    BasicEchonetLite<4, 64> packet;
+    EXPECT(packet.load(first.data(), first.size()));
+    Property property;
+    EXPECT(packet.findProperty(0x80, &property) && property.propertyDataCounter == 1 && property.payload[0] == 0x30);
+    EXPECT(packet.load(second.data(), second.size()));
+    EXPECT(!packet.findProperty(0x80, &property) && !packet.findProperty(0xE7, &property));
+    EXPECT(packet.findProperty(0xE8, &property) && property.payload == packet.data.arena.data() + EchonetLite::minimumFrameSize + 2);
+    // 容量を超えるプロパティ数のフレームは取り込まず、索引も残さない
+    const std::vector<uint8_t> tooMany = makeTestFrame(0x0000, testMeter, testController, Service::Get_Res, {{0x80, {}}, {0x81, {}}, {0x82, {}}, {0x83, {}}, {0x88, {}}});
+    EXPECT(!packet.load(tooMany.data(), tooMany.size()));
+    EXPECT(!packet.findProperty(0x80, &property) && !packet.findProperty(0xE8, &property));
+}
+
+} // namespace
+
+int main() {
+    testParse();
+    testTruncated();
+    testHex();
+    testLoadHex();
+    testSerialize();
+    testPropertyIndex();
+    return testResult();
+}
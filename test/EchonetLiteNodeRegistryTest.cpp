@@ -0,0 +1,175 @@
+#include "EchonetLiteNodeRegistry.hpp"
+#include "EchonetLiteTest.hpp"
+#include <vector>
+
+namespace {
+
+using Registry    = EchonetLiteNodeRegistry;
+using NodeAddress = Registry::NodeAddress;
+using Service     = EchonetLite::EchonetLiteService;
+
+/// @brief IPv4射影アドレス
+NodeAddress ipv4(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d) {
+    NodeAddress address;
+    address.bytes[10] = 0xFF;
+    address.bytes[11] = 0xFF;
+    address.bytes[12] = a;
+    address.bytes[13] = b;
+    address.bytes[14] = c;
+    address.bytes[15] = d;
+    return address;
+}
+
+/// @brief 送信したフレームの記録
+struct SentFrame {
+    NodeAddress address;
+    std::vector<uint8_t> frame;
+};
+
+Registry::Sender recorder(std::vector<SentFrame> &sent) {
+    return [&sent](const NodeAddress &address, const uint8_t *frame, size_t length) {
+        sent.push_back({address, std::vector<uint8_t>(frame, frame + length)});
+        return true;
+    };
+}
+
+std::vector<uint8_t> requestedProperties(const std::vector<uint8_t> &frame) {
+    std::vector<uint8_t> props;
+    for (const EchonetLite::EchonetLitePropertyView &property : EchonetLite::load(frame.data(), frame.size())) {
+        props.push_back(property.echonetLiteProperty);
+    }
+    return props;
+}
+
+/// @brief ノードアドレス・EOJごとの登録と検索
+void testAddAndFind() {
+    Registry registry;
+    std::vector<NodeAddress> addresses;
+    for (int i = 0; i < 200; i++) {
+        addresses.push_back(ipv4(192, 168, static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i)));
+        EXPECT(registry.add(addresses.back(), testMeter) == static_cast<size_t>(i));
+    }
+    EXPECT(registry.add(addresses[5], testMeter) == 5);
+    EXPECT(registry.add(addresses[5], testController) == 200);
+    EXPECT(registry.size() == 201);
+    for (int i = 0; i < 200; i++) {
+        const Registry::ObjectState *state = registry.find(addresses[i], testMeter);
+        EXPECT(state == &registry[i]);
+        EXPECT(registry.address(i) == addresses[i]);
+    }
+    EXPECT(registry.find(addresses[5], testController) == &registry[200]);
+    EXPECT(registry.find(addresses[6], testController) == nullptr);
+    EXPECT(registry.find(ipv4(10, 0, 0, 1), testMeter) == nullptr);
+}
+
+/// @brief 受信したプロパティマップ（列挙形式・ビットマップ形式）と値の取り込み
+void testReceive() {
+    Registry registry;
+    const NodeAddress address = ipv4(192, 168, 0, 10);
+    // Getプロパティマップ（ビットマップ形式）
+    std::vector<uint8_t> getMap(17, 0);
+    getMap[0] = 16;
+    for (const uint8_t prop : {0x80, 0x9F, 0xE0, 0xE7}) {
+        getMap[1 + (prop & 0x0F)] |= 1 << ((prop >> 4) - 8);
+    }
+    const std::vector<uint8_t> frame = makeTestFrame(0x0001, testMeter, testController, Service::Get_Res, {{0x9F, getMap}, {0x9E, {0x01, 0xE5}}, {0x9D, {0x01, 0x80}}, {0x80, {0x30}}});
+    const ptrdiff_t index            = registry.receive(address, EchonetLite::load(frame.data(), frame.size()), 100);
+    EXPECT(index == 0);
+    const Registry::ObjectState &state = registry[0];
+    EXPECT(state.hasPropertyMap);
+    EXPECT(state.getProperties.test(0x80) && state.getProperties.test(0x9F) && state.getProperties.test(0xE0) && state.getProperties.test(0xE7));
+    EXPECT(!state.getProperties.test(0xE8));
+    EXPECT(state.setProperties.test(0xE5) && !state.setProperties.test(0x80));
+    EXPECT(state.announceProperties.test(0x80));
+
+    EchonetLite::EchonetLitePropertyView value;
+    uint32_t updatedAt = 0;
+    EXPECT(registry.getValue(0, 0x80, &value, &updatedAt) && value.propertyDataCounter == 1 && value.payload[0] == 0x30 && updatedAt == 100);
+    EXPECT(!registry.getValue(0, 0xE7, &value));
+
+    // 空のプロパティマップは以前の内容を消さない
+    const std::vector<uint8_t> empty = makeTestFrame(0x0002, testMeter, testController, Service::Get_Res, {{0x9E, {0x00}}});
+    EXPECT(registry.receive(address, EchonetLite::load(empty.data(), empty.size()), 200) == 0);
+    EXPECT(registry[0].setProperties.test(0xE5));
+
+    const uint8_t truncated[] = {0x10, 0x81, 0x00};
+    EXPECT(registry.receive(address, EchonetLite::load(truncated, sizeof(truncated)), 300) == -1);
+}
+
+/// @brief 期限順の定期取得・応答照合・無応答の計数
+void testPolling() {
+    Registry registry;
+    const NodeAddress first  = ipv4(192, 168, 0, 1);
+    const NodeAddress second = ipv4(192, 168, 0, 2);
+    const size_t a           = registry.add(first, testMeter);
+    const size_t b           = registry.add(second, testMeter);
+    const uint8_t props[]    = {0xE7, 0xE0};
+    registry.setPolling(a, props, std::size(props), 1000, 0);
+    registry.setPolling(b, props, 1, 500, 100);
+
+    std::vector<SentFrame> sent;
+    EXPECT(registry.poll(0, 8, recorder(sent)) == 1);
+    EXPECT(sent.size() == 1 && sent[0].address == first);
+    EXPECT((requestedProperties(sent[0].frame) == std::vector<uint8_t>{0xE0, 0xE7}));
+    EXPECT(registry[a].awaiting);
+
+    // 送信数の上限
+    EXPECT(registry.poll(1000, 1, recorder(sent)) == 1);
+    EXPECT(sent.size() == 2 && sent[1].address == second);
+    EXPECT(registry.poll(1000, 8, recorder(sent)) == 1);
+    EXPECT(sent.size() == 3 && sent[2].address == first);
+    // 1回目の応答がないまま再要求したため無応答として数える
+    EXPECT(registry[a].misses == 1);
+
+    const std::vector<uint8_t> response = makeTestResponse(sent[2].frame, Service::Get_Res, {{0xE0, {0x00, 0x00, 0x00, 0x01}}, {0xE7, {0x00, 0x00, 0x00, 0x02}}});
+    EXPECT(registry.receive(first, EchonetLite::load(response.data(), response.size()), 1010) == static_cast<ptrdiff_t>(a));
+    EXPECT(!registry[a].awaiting && registry[a].misses == 0 && registry[a].respondedAt == 1010);
+    // TIDが一致しない応答では応答待ちを解除しない
+    const std::vector<uint8_t> other = makeTestFrame(0x7777, testMeter, testController, Service::Get_Res, {{0xE7, {0x00, 0x00, 0x00, 0x03}}});
+    EXPECT(registry.receive(second, EchonetLite::load(other.data(), other.size()), 1020) == static_cast<ptrdiff_t>(b));
+    EXPECT(registry[b].awaiting);
+
+    // 再設定した場合は以前の予定を破棄する
+    registry.setPolling(a, props, 1, 0, 1100);
+    EXPECT(registry.poll(5000, 8, recorder(sent)) == 1);
+    EXPECT(sent.back().address == second);
+}
+
+/// @brief 1フレームの上限を超えるEPCは周期ごとに続きから要求し、Get不可・アナウンス対象のEPCは除く
+void testPollingCursor() {
+    Registry registry;
+    const NodeAddress address = ipv4(192, 168, 0, 3);
+    const size_t index        = registry.add(address, testMeter);
+    std::vector<uint8_t> props;
+    for (int prop = 0xD0; prop < 0xD0 + 20; prop++) {
+        props.push_back(static_cast<uint8_t>(prop));
+    }
+    registry.setPolling(index, props.data(), props.size(), 1000, 0);
+
+    std::vector<SentFrame> sent;
+    EXPECT(registry.poll(0, 8, recorder(sent)) == 1);
+    EXPECT(requestedProperties(sent[0].frame).size() == Registry::maxPropsPerRequest);
+    EXPECT(requestedProperties(sent[0].frame).front() == 0xD0 && requestedProperties(sent[0].frame).back() == 0xDF);
+    // 続きのEPCから要求し、空きには先頭に戻って詰める
+    EXPECT(registry.poll(1000, 8, recorder(sent)) == 1);
+    const std::vector<uint8_t> second = requestedProperties(sent[1].frame);
+    EXPECT(second.size() == Registry::maxPropsPerRequest);
+    EXPECT(second[0] == 0xE0 && second[3] == 0xE3 && second[4] == 0xD0 && second.back() == 0xDB);
+
+    // Getプロパティマップ取得後はGet可能なEPCに絞り、アナウンス対象は値の取得後に除く
+    registry.suppressAnnounced = true;
+    const std::vector<uint8_t> maps = makeTestFrame(0x0000, testMeter, testController, Service::INF, {{0x9F, {0x03, 0xD0, 0xD1, 0xE3}}, {0x9D, {0x01, 0xD1}}, {0xD1, {0x01}}});
+    EXPECT(registry.receive(address, EchonetLite::load(maps.data(), maps.size()), 1500) == static_cast<ptrdiff_t>(index));
+    EXPECT(registry.poll(2000, 8, recorder(sent)) == 1);
+    EXPECT((requestedProperties(sent[2].frame) == std::vector<uint8_t>{0xE3, 0xD0}));
+}
+
+} // namespace
+
+int main() {
+    testAddAndFind();
+    testReceive();
+    testPolling();
+    testPollingCursor();
+    return testResult();
+}
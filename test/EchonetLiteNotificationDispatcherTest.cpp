@@ -0,0 +1,64 @@
+#include "EchonetLiteNotificationDispatcher.hpp"
+#include "EchonetLiteTest.hpp"
+#include <vector>
+
+namespace {
+
+using Dispatcher  = EchonetLiteNotificationDispatcher<4>;
+using NodeAddress = EchonetLiteNodeRegistry::NodeAddress;
+
+constexpr EchonetLite::EchonetLiteObject meter = testMeter;
+
+/// @brief 瞬時電力計測値（E7）のINFC
+const std::vector<uint8_t> infc = makeTestFrame(0x1234, testMeter, testController, EchonetLite::EchonetLiteService::INFC, {{0xE7, {0x00, 0x00, 0x01, 0x00}}});
+
+NodeAddress makeAddress(const uint8_t last) {
+    NodeAddress address;
+    address.bytes[15] = last;
+    return address;
+}
+
+/// @brief INFC_Resを通知の送信元へ返すこと
+void testResponseAddress() {
+    std::vector<NodeAddress> destinations;
+    std::vector<uint8_t> response;
+    Dispatcher dispatcher([&](const NodeAddress &address, const uint8_t *frame, size_t length) {
+        destinations.push_back(address);
+        response.assign(frame, frame + length);
+        return true;
+    });
+    EXPECT(dispatcher.dispatch(makeAddress(0x20), infc.data(), infc.size()) == 0);
+    EXPECT(destinations.size() == 1 && destinations[0] == makeAddress(0x20));
+    const std::vector<uint8_t> expected = {0x10, 0x81, 0x34, 0x12, 0x05, 0xFF, 0x01, 0x02, 0x88, 0x01, 0x7A, 0x01, 0xE7, 0x00};
+    EXPECT(response == expected);
+}
+
+/// @brief コールバック内で自身の購読を解除・再登録できること
+void testUnsubscribeInCallback() {
+    Dispatcher dispatcher([](const NodeAddress &, const uint8_t *, size_t) { return true; });
+    // 捕捉変数を大きくして関数オブジェクトをヒープに置き、解除時の破棄を検出しやすくする
+    std::vector<uint32_t> received;
+    const std::array<uint64_t, 8> padding = {};
+    size_t calls                           = 0;
+    EXPECT(dispatcher.subscribe(meter, 0xE7, [&dispatcher, &received, &calls, padding](const EchonetLite::EchonetLiteObject &, const EchonetLite::EchonetLitePropertyView &property) {
+        calls++;
+        received.push_back(property.propertyDataCounter + padding[0]);
+        EXPECT(dispatcher.unsubscribe(meter, 0xE7) == 1);
+        EXPECT(dispatcher.subscribe(meter, 0xE7, [&calls](const EchonetLite::EchonetLiteObject &, const EchonetLite::EchonetLitePropertyView &) { calls += 10; }));
+        // 解除後も捕捉変数を参照できる
+        received.push_back(padding[7]);
+    }));
+    EXPECT(dispatcher.dispatch(makeAddress(0x20), infc.data(), infc.size()) == 1);
+    EXPECT(calls == 1);
+    EXPECT((received == std::vector<uint32_t>{4, 0}));
+    EXPECT(dispatcher.dispatch(makeAddress(0x20), infc.data(), infc.size()) == 1);
+    EXPECT(calls == 11);
+}
+
+} // namespace
+
+int main() {
+    testResponseAddress();
+    testUnsubscribeInCallback();
+    return testResult();
+}
@@ -0,0 +1,114 @@
+#include "BasicEchonetLite.hpp"
+#include "EchonetLitePropertyCache.hpp"
+#include "EchonetLiteTest.hpp"
+#include "StorageBattery.hpp"
+
+namespace {
+
+using Cache     = EchonetLitePropertyCache<8>;
+using Service   = EchonetLite::EchonetLiteService;
+using MeterEpc  = LowVoltageSmartElectricEnergyMeterClass::Property;
+using Packet    = BasicEchonetLite<16, 64>;
+using FrameView = EchonetLite::EchonetLiteFrameView;
+
+constexpr uint32_t oneHour = 60UL * 60 * 1000;
+
+FrameView view(const std::vector<uint8_t> &frame) {
+    return EchonetLite::load(frame.data(), frame.size());
+}
+
+/// @brief 既定のTTL（スーパークラスは全クラス共通、メータ固有のEPCはメータのみ）
+void testDefaultTtl() {
+    const Cache cache;
+    EXPECT(cache.getTtl(static_cast<uint8_t>(EchonetLite::Property::GetPropertyMap)) == Cache::staticPropertyTtl);
+    EXPECT(cache.getTtl(StorageBatteryClass::eoj(), static_cast<uint8_t>(EchonetLite::Property::ManufacturerCode)) == Cache::staticPropertyTtl);
+    for (const MeterEpc prop : {MeterEpc::BRouteIdentificationNumber, MeterEpc::Coefficient, MeterEpc::CumulativeAmountEnergyEffectiveDigits, MeterEpc::CumulativeEnergyUnit}) {
+        EXPECT(cache.getTtl(testMeter, static_cast<uint8_t>(prop)) == Cache::staticPropertyTtl);
+        // 別インスタンスにも適用し、全クラス共通の設定にはしない
+        EXPECT(cache.getTtl(LowVoltageSmartElectricEnergyMeterClass::eoj(0x02), static_cast<uint8_t>(prop)) == Cache::staticPropertyTtl);
+        EXPECT(cache.getTtl(static_cast<uint8_t>(prop)) == 0);
+    }
+    // 蓄電池の0xD3（瞬時充放電電力）はメータの係数と同じEPCだがキャッシュしない
+    EXPECT(cache.getTtl(StorageBatteryClass::eoj(), 0xD3) == 0);
+    EXPECT(cache.getTtl(testMeter, 0xE7) == 0);
+}
+
+/// @brief クラス固有の設定を全クラス共通の設定より優先する
+void testClassTtl() {
+    Cache cache;
+    EXPECT(cache.setTtl(0xE7, 1000));
+    EXPECT(cache.setTtl(testMeter, 0xE7, 5000));
+    EXPECT(cache.getTtl(testMeter, 0xE7) == 5000);
+    EXPECT(cache.getTtl(StorageBatteryClass::eoj(), 0xE7) == 1000);
+    EXPECT(cache.setTtl(testMeter, 0xE7, 0));
+    EXPECT(cache.getTtl(testMeter, 0xE7) == 1000);
+}
+
+/// @brief TTLの間だけ値を返し、INFで通知された値に置き換える
+void testStoreAndAnnouncement() {
+    Cache cache;
+    EXPECT(cache.setTtl(testMeter, 0xE7, oneHour));
+    const std::vector<uint8_t> response = makeTestFrame(0x0001, testMeter, testController, Service::Get_Res, {{0xE7, {0x00, 0x00, 0x01, 0x00}}, {0xD3, {0x00, 0x00, 0x00, 0x01}}, {0xE8, {0x00, 0x0A, 0x00, 0x0B}}});
+    // TTL未設定のE8は格納しない
+    EXPECT(cache.store(view(response), 0) == 2);
+
+    int32_t power = 0;
+    EXPECT((cache.get<LowVoltageSmartElectricEnergyMeterClass::PropertySchemaOf<MeterEpc::InstantaneousPower>>(testMeter, 0xE7, 1000, &power) && power == 256));
+    EXPECT((!cache.get<LowVoltageSmartElectricEnergyMeterClass::PropertySchemaOf<MeterEpc::InstantaneousPower>>(testMeter, 0xE7, oneHour, &power)));
+    EchonetLite::EchonetLitePropertyView property;
+    EXPECT(!cache.find(testMeter, 0xE8, 0, &property));
+    EXPECT(cache.find(testMeter, 0xD3, Cache::staticPropertyTtl - 1, &property) && property.propertyDataCounter == 4);
+    // 別インスタンスの値ではない
+    EXPECT(!cache.find(LowVoltageSmartElectricEnergyMeterClass::eoj(0x02), 0xD3, 0, &property));
+
+    // INFの値は古い値を置き換え、受信時刻からTTLを数える
+    const std::vector<uint8_t> announcement = makeTestFrame(0x0000, testMeter, testController, Service::INF, {{0xE7, {0x00, 0x00, 0x02, 0x00}}});
+    EXPECT(cache.store(view(announcement), oneHour - 10) == 1);
+    EXPECT((cache.get<LowVoltageSmartElectricEnergyMeterClass::PropertySchemaOf<MeterEpc::InstantaneousPower>>(testMeter, 0xE7, oneHour + 10, &power) && power == 512));
+
+    // 値のないINF・Set系の応答は格納しない
+    EXPECT(cache.store(view(makeTestFrame(0x0000, testMeter, testController, Service::INF, {{0xE7, {}}})), 0) == 0);
+    EXPECT(cache.store(view(makeTestFrame(0x0002, testMeter, testController, Service::Set_Res, {{0xE7, {0x00, 0x00, 0x03, 0x00}}})), 0) == 0);
+
+    cache.invalidate(testMeter, 0xE7);
+    EXPECT(!cache.find(testMeter, 0xE7, oneHour + 10, &property));
+    cache.invalidate(testMeter);
+    EXPECT(!cache.find(testMeter, 0xD3, oneHour + 10, &property));
+}
+
+/// @brief 有効期間切れのEPCだけを要求する
+void testGenerateGetRequest() {
+    Cache cache;
+    EXPECT(cache.store(view(makeTestFrame(0x0001, testMeter, testController, Service::Get_Res, {{0xD3, {0x00, 0x00, 0x00, 0x01}}})), 0) == 1);
+
+    Packet request;
+    const uint8_t props[] = {0xD3, 0xE7, 0xE1};
+    EXPECT(cache.generateGetRequest(request, testMeter, props, std::size(props), 0));
+    EXPECT(request.data.EDATA.echonetLiteService == Service::Get);
+    EXPECT(request.data.payloadCount == 2);
+    EXPECT(request.data.payload[0].echonetLiteProperty == 0xE7 && request.data.payload[1].echonetLiteProperty == 0xE1);
+    EXPECT(request.data.EDATA.DEOJ.classCode == testMeter.classCode);
+
+    // 全て有効な場合は要求しない
+    const uint8_t fresh[] = {0xD3};
+    EXPECT(!cache.generateGetRequest(request, testMeter, fresh, std::size(fresh), 0));
+
+    // 1フレームに収まらないEPC数は切り詰めずに失敗する
+    std::vector<uint8_t> tooMany(256);
+    for (size_t i = 0; i < tooMany.size(); i++) {
+        tooMany[i] = static_cast<uint8_t>(i);
+    }
+    EXPECT(!cache.generateGetRequest(request, testMeter, tooMany.data(), tooMany.size(), 0));
+    // パケットの容量を超える場合も失敗する
+    EXPECT(!cache.generateGetRequest(request, testMeter, tooMany.data(), 32, 0));
+}
+
+} // namespace
+
+int main() {
+    testDefaultTtl();
+    testClassTtl();
+    testStoreAndAnnouncement();
+    testGenerateGetRequest();
+    return testResult();
+}
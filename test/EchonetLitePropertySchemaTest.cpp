@@ -0,0 +1,121 @@
+#include "EchonetLiteTest.hpp"
+#include "LowVoltageSmartElectricEnergyMeter.hpp"
+#include <vector>
+
+namespace {
+
+using Meter         = LowVoltageSmartElectricEnergyMeterClass;
+using MeterProperty = Meter::Property;
+using Currents      = Meter::PropertySchemaOf<MeterProperty::InstantaneousCurrents>;
+using Signed        = EchonetLitePropertyDescriptor<0, true, int16_t>;
+using Unsigned      = EchonetLitePropertyDescriptor<0, true, uint16_t>;
+using Unchecked     = EchonetLitePropertyDescriptor<0, false, uint8_t>;
+using Mixed         = EchonetLitePropertyDescriptor<2, true, uint8_t, int32_t, uint16_t>;
+
+// フィールド構成・オフセット・倍率はコンパイル時に決まる
+static_assert(std::is_same_v<Currents::value_type, std::tuple<int16_t, int16_t>>);
+static_assert(Currents::size == 4 && Currents::offsets[1] == 2);
+static_assert(Currents::scaleExponent == -1);
+static_assert(std::is_same_v<Signed::value_type, int16_t>);
+static_assert(Mixed::size == 7 && Mixed::offsets[0] == 0 && Mixed::offsets[1] == 1 && Mixed::offsets[2] == 5);
+static_assert(Mixed::scale == 100.0f);
+static_assert(EchonetLitePropertyDescriptor<-3, false, uint8_t>::scale > 0.000999f && EchonetLitePropertyDescriptor<-3, false, uint8_t>::scale < 0.001001f);
+static_assert(Meter::PropertySchemaOf<MeterProperty::Coefficient>::checkSentinel);
+static_assert(!Unchecked::checkSentinel);
+
+template <class Schema>
+bool decode(const std::vector<uint8_t> &edt, typename Schema::value_type *const out) {
+    EXPECT(edt.size() == Schema::size);
+    return EchonetLite::decodeProperty<Schema>(edt.data(), out);
+}
+
+/// @brief 非整列位置でのビッグエンディアン読み書き
+void testBigEndian() {
+    uint8_t buffer[9] = {};
+    EchonetLite::writeBigEndian<uint8_t>(0xA5, buffer + 1);
+    EXPECT(buffer[1] == 0xA5 && EchonetLite::readBigEndian<uint8_t>(buffer + 1) == 0xA5);
+    EchonetLite::writeBigEndian<uint16_t>(0x1234, buffer + 1);
+    EXPECT(buffer[1] == 0x12 && buffer[2] == 0x34);
+    EXPECT(EchonetLite::readBigEndian<uint16_t>(buffer + 1) == 0x1234);
+    EchonetLite::writeBigEndian<int32_t>(-2, buffer + 1);
+    EXPECT(buffer[1] == 0xFF && buffer[2] == 0xFF && buffer[3] == 0xFF && buffer[4] == 0xFE);
+    EXPECT(EchonetLite::readBigEndian<int32_t>(buffer + 1) == -2);
+    EchonetLite::writeBigEndian<uint64_t>(0x0102030405060708ULL, buffer + 1);
+    EXPECT((std::vector<uint8_t>(buffer + 1, buffer + 9) == std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}));
+    EXPECT(EchonetLite::readBigEndian<uint64_t>(buffer + 1) == 0x0102030405060708ULL);
+    EXPECT(EchonetLite::readBigEndian<int64_t>(buffer + 1) == 0x0102030405060708LL);
+    EXPECT(buffer[0] == 0x00);
+
+    // 受信したEDTは送信順のまま保持し、取得時に変換する
+    Meter meter;
+    meter.generateGetRequest<MeterProperty::InstantaneousPower>();
+    const std::vector<uint8_t> response = makeTestFrame(meter.nextTransactionId, testMeter, testController, EchonetLite::EchonetLiteService::Get_Res, {{0xE7, {0x00, 0x01, 0x02, 0x03}}});
+    EXPECT(meter.load(EchonetLite::load(response.data(), response.size())));
+    const EchonetLite::EchonetLitePayload *const payload = meter.findProperty(0xE7);
+    EXPECT(payload != nullptr && payload->propertyDataCounter == 4);
+    EXPECT((payload->payload == std::vector<uint8_t>{0x00, 0x01, 0x02, 0x03}));
+    int32_t power = 0;
+    EXPECT(meter.get<MeterProperty::InstantaneousPower>(&power) && power == 0x00010203);
+}
+
+/// @brief 未設定値の判定（符号付きは最小値・最大値・最大値-1、符号なしは最大値・最大値-1を無効とする）
+void testSentinel() {
+    int16_t value = 0;
+    EXPECT(!decode<Signed>({0x80, 0x00}, &value));
+    EXPECT(!decode<Signed>({0x7F, 0xFF}, &value));
+    EXPECT(!decode<Signed>({0x7F, 0xFE}, &value));
+    EXPECT(decode<Signed>({0x80, 0x01}, &value) && value == -32767);
+    EXPECT(decode<Signed>({0x7F, 0xFD}, &value) && value == 32765);
+
+    uint16_t unsignedValue = 1;
+    EXPECT(decode<Unsigned>({0x00, 0x00}, &unsignedValue) && unsignedValue == 0);
+    EXPECT(!decode<Unsigned>({0xFF, 0xFF}, &unsignedValue));
+    EXPECT(!decode<Unsigned>({0xFF, 0xFE}, &unsignedValue));
+    EXPECT(decode<Unsigned>({0xFF, 0xFD}, &unsignedValue) && unsignedValue == 0xFFFD);
+
+    // 判定しない定義（列挙値等）は全値を有効とする
+    uint8_t status = 0;
+    EXPECT(decode<Unchecked>({0xFF}, &status) && status == 0xFF);
+
+    // 複数フィールドはいずれかが未設定値なら無効
+    Currents::value_type currents;
+    EXPECT((decode<Currents>({0x00, 0x0F, 0xFF, 0xF6}, &currents) && currents == std::make_tuple<int16_t, int16_t>(15, -10)));
+    EXPECT(!decode<Currents>({0x00, 0x0F, 0x7F, 0xFE}, &currents));
+}
+
+/// @brief 型付きのget<>()・encode<>()（PDCが定義と異なるEDTは無効）
+void testTypedAccess() {
+    Meter meter;
+    meter.generateGetRequest<MeterProperty::InstantaneousPower, MeterProperty::InstantaneousCurrents, MeterProperty::Coefficient>();
+    const std::vector<uint8_t> response = makeTestFrame(meter.nextTransactionId, testMeter, testController, EchonetLite::EchonetLiteService::Get_Res, {{0xE7, {0xFF, 0xFF, 0xFF, 0x9C}}, {0xE8, {0x00, 0x0F, 0x00}}, {0xD3, {0x00, 0x00, 0x00, 0x64}}, {0x80, {0x30}}});
+    EXPECT(meter.load(EchonetLite::load(response.data(), response.size())));
+
+    int32_t power = 0;
+    EXPECT(meter.get<MeterProperty::InstantaneousPower>(&power) && power == -100);
+    Currents::value_type currents = {1, 2};
+    EXPECT(!meter.get<MeterProperty::InstantaneousCurrents>(&currents));
+    EXPECT((currents == std::make_tuple<int16_t, int16_t>(1, 2)));
+    uint32_t coefficient = 0;
+    EXPECT(meter.get<MeterProperty::Coefficient>(&coefficient) && coefficient == 100);
+    uint8_t status = 0;
+    EXPECT(meter.get<EchonetLite::Property::OperationStatus>(&status) && status == 0x30);
+    int32_t missing = 0;
+    EXPECT(!meter.get<MeterProperty::CumulativeEnergyPositive>(&missing));
+
+    uint8_t edt[Mixed::size];
+    EXPECT(EchonetLite::encodeProperty<Mixed>({0x12, -2, 0xABCD}, edt) == Mixed::size);
+    EXPECT((std::vector<uint8_t>(edt, edt + sizeof(edt)) == std::vector<uint8_t>{0x12, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB, 0xCD}));
+    Mixed::value_type mixed;
+    EXPECT((EchonetLite::decodeProperty<Mixed>(edt, &mixed) && mixed == std::make_tuple<uint8_t, int32_t, uint16_t>(0x12, -2, 0xABCD)));
+    EXPECT(Meter::encode<MeterProperty::InstantaneousCurrents>({-10, 25}, edt) == 4);
+    EXPECT(edt[0] == 0xFF && edt[1] == 0xF6 && edt[2] == 0x00 && edt[3] == 0x19);
+}
+
+} // namespace
+
+int main() {
+    testBigEndian();
+    testSentinel();
+    testTypedAccess();
+    return testResult();
+}
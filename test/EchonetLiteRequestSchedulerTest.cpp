@@ -0,0 +1,162 @@
+#include "EchonetLiteRequestScheduler.hpp"
+#include "EchonetLiteTest.hpp"
+#include "EchonetLiteTransactionManager.hpp"
+#include <vector>
+
+namespace {
+
+using Manager   = EchonetLiteTransactionManager<4>;
+using Scheduler = EchonetLiteRequestScheduler<Manager, 8, 4>;
+using Status    = Manager::Status;
+using Service   = EchonetLite::EchonetLiteService;
+using Property  = EchonetLite::EchonetLitePropertyView;
+
+/// @brief 送信したフレームのEPC列
+std::vector<uint8_t> requestedProperties(const std::vector<uint8_t> &frame) {
+    const EchonetLite::EchonetLiteFrameView view = EchonetLite::load(frame.data(), frame.size());
+    std::vector<uint8_t> props;
+    for (const Property &property : view) {
+        props.push_back(property.echonetLiteProperty);
+    }
+    return props;
+}
+
+/// @brief 要求ごとの完了記録
+struct Result {
+    size_t calls      = 0;
+    Status status     = Status::Timeout;
+    bool found        = false;
+    uint8_t firstByte = 0;
+
+    Scheduler::Callback callback() {
+        return [this](Status result, const Property *property) {
+            calls++;
+            status = result;
+            found  = property != nullptr;
+            if (property != nullptr && property->propertyDataCounter > 0) {
+                firstByte = property->payload[0];
+            }
+        };
+    }
+};
+
+/// @brief 同一DEOJ宛の要求を1フレームにまとめ、重複EPCは1回だけ要求する
+void testCoalesce() {
+    std::vector<std::vector<uint8_t>> sent;
+    Manager manager([&sent](const uint8_t *frame, size_t length) {
+        sent.emplace_back(frame, frame + length);
+        return true;
+    });
+    Scheduler scheduler(manager);
+    Result power;
+    Result energy;
+    Result duplicate;
+    Result missing;
+    EXPECT(scheduler.request(testMeter, 0xE7, power.callback()));
+    EXPECT(scheduler.request(testMeter, 0xE0, energy.callback()));
+    EXPECT(scheduler.request(testMeter, 0xE7, duplicate.callback()));
+    EXPECT(scheduler.request(testMeter, 0xE3, missing.callback()));
+    EXPECT(scheduler.pending() == 4);
+
+    EXPECT(scheduler.flush(0) == 1);
+    EXPECT(sent.size() == 1);
+    EXPECT((requestedProperties(sent[0]) == std::vector<uint8_t>{0xE7, 0xE0, 0xE3}));
+    EXPECT(sent[0][10] == static_cast<uint8_t>(Service::Get));
+    EXPECT(sent[0][7] == static_cast<uint8_t>(testMeter.classGroupCode) && sent[0][8] == testMeter.classCode && sent[0][9] == testMeter.instanceCode);
+    EXPECT(scheduler.pending() == 0 && scheduler.inFlight() == 4);
+    // 送信済みの要求は再送しない
+    EXPECT(scheduler.flush(0) == 0);
+
+    const std::vector<uint8_t> response = makeTestResponse(sent[0], Service::Get_Res, {{0xE7, {0x01, 0x00, 0x00, 0x00}}, {0xE0, {0x02, 0x00, 0x00, 0x00}}});
+    EXPECT(manager.receive(response.data(), response.size()));
+    EXPECT(power.calls == 1 && power.status == Status::Completed && power.found && power.firstByte == 0x01);
+    EXPECT(duplicate.calls == 1 && duplicate.found && duplicate.firstByte == 0x01);
+    EXPECT(energy.calls == 1 && energy.found && energy.firstByte == 0x02);
+    // 応答に含まれなかったEPCはnullptr
+    EXPECT(missing.calls == 1 && missing.status == Status::Completed && !missing.found);
+    EXPECT(scheduler.inFlight() == 0);
+}
+
+/// @brief DEOJごとにフレームを分け、1フレームのEPC数の上限を超えた分は次のフレームへ分割する
+void testSplit() {
+    std::vector<std::vector<uint8_t>> sent;
+    Manager manager([&sent](const uint8_t *frame, size_t length) {
+        sent.emplace_back(frame, frame + length);
+        return true;
+    });
+    Scheduler scheduler(manager, 2);
+    Result results[5];
+    EXPECT(scheduler.request(testMeter, 0xE7, results[0].callback()));
+    EXPECT(scheduler.request(testBattery, 0xE4, results[1].callback()));
+    EXPECT(scheduler.request(testMeter, 0xE0, results[2].callback()));
+    EXPECT(scheduler.request(testMeter, 0xE3, results[3].callback()));
+    EXPECT(scheduler.request(testMeter, 0xE7, results[4].callback()));
+
+    EXPECT(scheduler.flush(0) == 3);
+    EXPECT(sent.size() == 3);
+    EXPECT((requestedProperties(sent[0]) == std::vector<uint8_t>{0xE7, 0xE0}));
+    EXPECT((requestedProperties(sent[1]) == std::vector<uint8_t>{0xE4}));
+    EXPECT(sent[1][8] == testBattery.classCode);
+    EXPECT((requestedProperties(sent[2]) == std::vector<uint8_t>{0xE3}));
+
+    // 応答がなければ各要求元にTimeoutを通知する
+    for (uint32_t now = 0; now <= 30000; now += 1000) {
+        manager.poll(now);
+    }
+    for (const Result &result : results) {
+        EXPECT(result.calls == 1 && result.status == Status::Timeout && !result.found);
+    }
+    EXPECT(scheduler.inFlight() == 0 && manager.inFlight() == 0);
+}
+
+/// @brief 送信できなかった要求は保留したまま持ち越し、保留数の上限は応答待ちを含む
+void testRetainOnFailure() {
+    bool online = false;
+    std::vector<std::vector<uint8_t>> sent;
+    Manager manager([&online, &sent](const uint8_t *frame, size_t length) {
+        if (online) {
+            sent.emplace_back(frame, frame + length);
+        }
+        return online;
+    });
+    Scheduler scheduler(manager);
+    Result results[8];
+    for (uint8_t i = 0; i < 8; i++) {
+        EXPECT(scheduler.request(testMeter, static_cast<uint8_t>(0xE0 + i), results[i].callback()));
+    }
+    Result overflow;
+    EXPECT(!scheduler.request(testMeter, 0xE8, overflow.callback()));
+
+    EXPECT(scheduler.flush(0) == 0);
+    EXPECT(scheduler.pending() == 8 && scheduler.inFlight() == 0);
+
+    online = true;
+    EXPECT(scheduler.flush(0) == 2);
+    EXPECT(scheduler.pending() == 0 && scheduler.inFlight() == 8);
+    EXPECT(!scheduler.request(testMeter, 0xE8, overflow.callback()));
+
+    const std::vector<uint8_t> response = makeTestResponse(sent[0], Service::Get_SNA, {{0xE0, {}}, {0xE1, {}}, {0xE2, {}}, {0xE3, {}}});
+    EXPECT(manager.receive(response.data(), response.size()));
+    for (uint8_t i = 0; i < 4; i++) {
+        EXPECT(results[i].calls == 1 && results[i].status == Status::NotAvailable);
+    }
+    EXPECT(results[4].calls == 0);
+    EXPECT(scheduler.inFlight() == 4);
+
+    // 完了通知の中から次の要求を保留できる
+    Result next;
+    EXPECT(scheduler.request(testBattery, 0x80, [&scheduler, &next](Status, const Property *) { EXPECT(scheduler.request(testMeter, 0xE8, next.callback())); }));
+    EXPECT(scheduler.flush(0) == 1);
+    const std::vector<uint8_t> battery = makeTestResponse(sent[2], Service::Get_Res, {{0x80, {0x30}}});
+    EXPECT(manager.receive(battery.data(), battery.size()));
+    EXPECT(scheduler.pending() == 1 && scheduler.inFlight() == 4 && next.calls == 0);
+}
+
+} // namespace
+
+int main() {
+    testCoalesce();
+    testSplit();
+    testRetainOnFailure();
+    return testResult();
+}
@@ -0,0 +1,86 @@
+#include "EchonetLiteSetRequest.hpp"
+#include "EchonetLiteTest.hpp"
+#include "EchonetLiteTransactionManager.hpp"
+#include "StorageBattery.hpp"
+#include <vector>
+
+namespace {
+
+using Manager    = EchonetLiteTransactionManager<4>;
+using SetRequest = EchonetLiteSetRequest<StorageBatteryClass, 64>;
+using Property   = StorageBatteryClass::Property;
+using Service    = EchonetLite::EchonetLiteService;
+
+/// @brief SetGet要求をトランザクションマネージャで送信し、Get要求と重複しないTIDで応答を照合できること
+void testSubmitSetGet() {
+    std::vector<std::vector<uint8_t>> sent;
+    Manager manager([&sent](const uint8_t *frame, size_t length) {
+        sent.emplace_back(frame, frame + length);
+        return true;
+    });
+
+    StorageBatteryClass battery;
+    battery.generateGetRequest<Property::RemainingStoredElectricity3>();
+    EXPECT(manager.submit(battery, 0, [](Manager::Status, const EchonetLite::EchonetLiteFrameView &) {}));
+
+    SetRequest request;
+    EXPECT(request.begin(Service::SetGet));
+    EXPECT(request.addSetGet<Property::OperationModeSetting>(static_cast<uint8_t>(StorageBatteryClass::OperationMode::Charging)));
+    EXPECT(request.addSetGet<Property::ChargingPowerSetting>(2000));
+    Manager::Status status = Manager::Status::Timeout;
+    size_t completions     = 0;
+    EXPECT(manager.submit(request, 0, [&status, &completions](Manager::Status result, const EchonetLite::EchonetLiteFrameView &) {
+        status = result;
+        completions++;
+    }));
+    EXPECT(sent.size() == 2);
+    EXPECT(request.transactionId() != battery.data.EHEAD.TransactionId);
+    EXPECT(manager.inFlight() == 2);
+
+    // 送信したフレームに書き換え後のTIDが入っている
+    const std::vector<uint8_t> &frame = sent[1];
+    EXPECT(frame.size() == request.size());
+    EXPECT(frame[2] == static_cast<uint8_t>(request.transactionId()) && frame[3] == static_cast<uint8_t>(request.transactionId() >> 8));
+    EXPECT(frame[10] == static_cast<uint8_t>(Service::SetGet));
+
+    const std::vector<uint8_t> response = makeTestResponseRaw(frame, Service::SetGet_Res, encodeTestSetGetProperties({{0xDA, {}}, {0xEB, {}}}, {{0xDA, {0x42}}, {0xEB, {0x00, 0x00, 0x07, 0xD0}}}));
+    EXPECT(manager.receive(response.data(), response.size()));
+    EXPECT(completions == 1 && status == Manager::Status::Completed);
+    EXPECT(manager.inFlight() == 1);
+
+    const SetRequest::Response parsed = SetRequest::parse(response.data(), response.size());
+    EXPECT(parsed.isAccepted());
+    EXPECT(request.verify(parsed));
+    uint32_t power = 0;
+    EXPECT(parsed.get<Property::ChargingPowerSetting>(&power) && power == 2000);
+}
+
+/// @brief SetCの不可応答を照合できること
+void testSubmitSetCNotAvailable() {
+    std::vector<uint8_t> sent;
+    Manager manager([&sent](const uint8_t *frame, size_t length) {
+        sent.assign(frame, frame + length);
+        return true;
+    });
+
+    SetRequest request;
+    EXPECT(request.begin(Service::SetC, 0x02));
+    EXPECT(request.addSet<Property::DischargingPowerSetting>(1500));
+    Manager::Status status = Manager::Status::Completed;
+    EXPECT(manager.submit(request, 0, [&status](Manager::Status result, const EchonetLite::EchonetLiteFrameView &) { status = result; }));
+    EXPECT(sent.size() == 18 && sent[9] == 0x02);
+
+    const std::vector<uint8_t> response = makeTestResponse(sent, Service::SetC_SNA, {{0xEC, {0x00, 0x00, 0x05, 0xDC}}});
+    EXPECT(manager.receive(response.data(), response.size()));
+    EXPECT(status == Manager::Status::NotAvailable);
+    const SetRequest::Response parsed = SetRequest::parse(response.data(), response.size());
+    EXPECT(parsed.valid && !parsed.isAccepted() && !request.verify(parsed));
+}
+
+} // namespace
+
+int main() {
+    testSubmitSetGet();
+    testSubmitSetCNotAvailable();
+    return testResult();
+}
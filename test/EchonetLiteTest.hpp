@@ -0,0 +1,97 @@
+#pragma once
+
+#include "EchonetLite.hpp"
+#include <cstdio>
+#include <iterator>
+#include <vector>
+
+/// @brief 失敗した検査の数
+inline int &testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+/// @brief 条件の検査（失敗しても続行する）
+#define EXPECT(condition)                                                                       \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            std::fprintf(stderr, "%s:%d: EXPECT(%s) failed\n", __FILE__, __LINE__, #condition); \
+            testFailures()++;                                                                   \
+        }                                                                                       \
+    } while (0)
+
+/// @brief 終了コード（失敗があれば1）
+inline int testResult() {
+    if (testFailures() != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", testFailures());
+        return 1;
+    }
+    return 0;
+}
+
+/// @brief コントローラ（05FF01）
+constexpr EchonetLite::EchonetLiteObject testController = {EchonetLite::ClassGroupCode::ManagementOperationDeviceClassGroup, 0xFF, 0x01};
+
+/// @brief 低圧スマート電力量メータ（028801）
+constexpr EchonetLite::EchonetLiteObject testMeter = {EchonetLite::ClassGroupCode::HousingFacilitiesDeviceClassGroup, 0x88, 0x01};
+
+/// @brief 蓄電池（027D01）
+constexpr EchonetLite::EchonetLiteObject testBattery = {EchonetLite::ClassGroupCode::HousingFacilitiesDeviceClassGroup, 0x7D, 0x01};
+
+/// @brief テストフレームのプロパティ（EPC・EDT）
+struct TestProperty {
+    uint8_t epc;
+    std::vector<uint8_t> edt;
+};
+
+/// @brief OPCとプロパティ列（EPC・PDC・EDT）
+inline std::vector<uint8_t> encodeTestProperties(const std::vector<TestProperty> &properties) {
+    std::vector<uint8_t> bytes = {static_cast<uint8_t>(properties.size())};
+    for (const TestProperty &property : properties) {
+        bytes.push_back(property.epc);
+        bytes.push_back(static_cast<uint8_t>(property.edt.size()));
+        std::copy(property.edt.begin(), property.edt.end(), std::back_inserter(bytes));
+    }
+    return bytes;
+}
+
+/// @brief SetGetのOPCSet・Set部・OPCGet・Get部
+inline std::vector<uint8_t> encodeTestSetGetProperties(const std::vector<TestProperty> &set, const std::vector<TestProperty> &get) {
+    std::vector<uint8_t> bytes      = encodeTestProperties(set);
+    const std::vector<uint8_t> gets  = encodeTestProperties(get);
+    std::copy(gets.begin(), gets.end(), std::back_inserter(bytes));
+    return bytes;
+}
+
+/// @brief テストフレーム（bodyはOPC以降のバイト列）
+inline std::vector<uint8_t> makeTestFrameRaw(const uint16_t transactionId, const EchonetLite::EchonetLiteObject &source, const EchonetLite::EchonetLiteObject &destination, const EchonetLite::EchonetLiteService service, const std::vector<uint8_t> &body) {
+    std::vector<uint8_t> frame = {
+        0x10, 0x81, static_cast<uint8_t>(transactionId), static_cast<uint8_t>(transactionId >> 8),
+        static_cast<uint8_t>(source.classGroupCode), source.classCode, source.instanceCode,
+        static_cast<uint8_t>(destination.classGroupCode), destination.classCode, destination.instanceCode,
+        static_cast<uint8_t>(service),
+    };
+    std::copy(body.begin(), body.end(), std::back_inserter(frame));
+    return frame;
+}
+
+/// @brief テストフレーム
+inline std::vector<uint8_t> makeTestFrame(const uint16_t transactionId, const EchonetLite::EchonetLiteObject &source, const EchonetLite::EchonetLiteObject &destination, const EchonetLite::EchonetLiteService service, const std::vector<TestProperty> &properties) {
+    return makeTestFrameRaw(transactionId, source, destination, service, encodeTestProperties(properties));
+}
+
+/// @brief 要求フレームへの応答（TIDを引き継ぎ、SEOJ・DEOJを入れ替える。bodyはOPC以降のバイト列）
+inline std::vector<uint8_t> makeTestResponseRaw(const std::vector<uint8_t> &request, const EchonetLite::EchonetLiteService service, const std::vector<uint8_t> &body) {
+    const EchonetLite::EchonetLiteFrameView frame = EchonetLite::load(request.data(), request.size());
+    return makeTestFrameRaw(frame.EHEAD.TransactionId, frame.EDATA.DEOJ, frame.EDATA.SEOJ, service, body);
+}
+
+/// @brief 要求フレームへの応答
+inline std::vector<uint8_t> makeTestResponse(const std::vector<uint8_t> &request, const EchonetLite::EchonetLiteService service, const std::vector<TestProperty> &properties) {
+    return makeTestResponseRaw(request, service, encodeTestProperties(properties));
+}
+
+/// @brief 低圧スマート電力量メータからコントローラへの瞬時電力計測値（E7、256W）のGet_Res
+inline std::vector<uint8_t> makeMeterFrame(const uint16_t transactionId) {
+    return makeTestFrame(transactionId, testMeter, testController, EchonetLite::EchonetLiteService::Get_Res, {{0xE7, {0x00, 0x00, 0x01, 0x00}}});
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "BasicEchonetLite.hpp"
+#include "EchonetLiteTest.hpp"
+#include "EchonetLiteTransactionManager.hpp"
+#include <vector>
+
+namespace {
+
+using Manager = EchonetLiteTransactionManager<2>;
+using Request = BasicEchonetLite<4, 32>;
+using Status  = Manager::Status;
+using Service = EchonetLite::EchonetLiteService;
+
+/// @brief 送信フレームの記録
+struct Link {
+    std::vector<std::vector<uint8_t>> sent;
+    Manager manager{[this](const uint8_t *frame, size_t length) {
+        sent.emplace_back(frame, frame + length);
+        return true;
+    }};
+};
+
+/// @brief 要求ごとの完了記録
+struct Result {
+    size_t calls  = 0;
+    Status status = Status::Completed;
+    bool valid    = false;
+
+    Manager::Callback callback() {
+        return [this](Status result, const EchonetLite::EchonetLiteFrameView &frame) {
+            calls++;
+            status = result;
+            valid  = frame.valid;
+        };
+    }
+};
+
+/// @brief メータ宛の瞬時電力計測値のGet要求
+Request makeRequest(const Service service = Service::Get) {
+    static const uint8_t properties[] = {0xE7};
+    Request request;
+    request.generateGetRequest(properties, 1);
+    request.data.EDATA.DEOJ               = testMeter;
+    request.data.EDATA.echonetLiteService = service;
+    return request;
+}
+
+/// @brief 要求ごとに重複しないTIDを払い出し、空きがなければ登録しない
+void testSubmit() {
+    Link link;
+    Result first;
+    Result second;
+    Result third;
+    Request request = makeRequest();
+    EXPECT(link.manager.submit(request, 0, first.callback()));
+    const uint16_t firstId = request.data.EHEAD.TransactionId;
+    EXPECT(link.manager.submit(request, 0, second.callback()));
+    EXPECT(request.data.EHEAD.TransactionId != firstId);
+    EXPECT(!link.manager.submit(request, 0, third.callback()));
+    EXPECT(link.manager.inFlight() == 2 && link.sent.size() == 2);
+
+    // TIDまたは応答元クラスが異なる応答は照合しない
+    const std::vector<uint8_t> response = makeTestResponse(link.sent[0], Service::Get_Res, {{0xE7, {0x00, 0x00, 0x01, 0x00}}});
+    std::vector<uint8_t> otherTid       = response;
+    otherTid[2] ^= 0x80;
+    EXPECT(!link.manager.receive(otherTid.data(), otherTid.size()));
+    const std::vector<uint8_t> otherClass = makeTestFrame(firstId, testBattery, testController, Service::Get_Res, {{0xE7, {0x00, 0x00, 0x01, 0x00}}});
+    EXPECT(!link.manager.receive(otherClass.data(), otherClass.size()));
+    EXPECT(first.calls == 0);
+
+    EXPECT(link.manager.receive(response.data(), response.size()));
+    EXPECT(first.calls == 1 && first.status == Status::Completed && first.valid);
+    EXPECT(!link.manager.receive(response.data(), response.size()));
+    EXPECT(first.calls == 1 && link.manager.inFlight() == 1);
+
+    // 不可応答
+    const std::vector<uint8_t> rejected = makeTestResponse(link.sent[1], Service::Get_SNA, {{0xE7, {}}});
+    EXPECT(link.manager.receive(rejected.data(), rejected.size()));
+    EXPECT(second.calls == 1 && second.status == Status::NotAvailable && second.valid);
+    EXPECT(link.manager.inFlight() == 0);
+}
+
+/// @brief 期限切れの要求は間隔を倍にしながら同じフレームを再送し、再送後も応答がなければTimeout
+void testRetry() {
+    Link link;
+    Result result;
+    Request request = makeRequest();
+    EXPECT(link.manager.submit(request, 1000, result.callback(), 100, 2));
+    link.manager.poll(1099);
+    EXPECT(link.sent.size() == 1);
+    link.manager.poll(1100);
+    EXPECT(link.sent.size() == 2 && link.sent[1] == link.sent[0]);
+    link.manager.poll(1299);
+    EXPECT(link.sent.size() == 2);
+    link.manager.poll(1300);
+    EXPECT(link.sent.size() == 3 && link.sent[2] == link.sent[0]);
+    link.manager.poll(1699);
+    EXPECT(result.calls == 0);
+    link.manager.poll(1700);
+    EXPECT(result.calls == 1 && result.status == Status::Timeout && !result.valid);
+    EXPECT(link.sent.size() == 3 && link.manager.inFlight() == 0);
+
+    // 時刻カウンタの周回をまたいでも期限を比較できる
+    Result wrapped;
+    EXPECT(link.manager.submit(request, 0xFFFFFFF0u, wrapped.callback(), 0x20, 0));
+    link.manager.poll(0x0000000Fu);
+    EXPECT(wrapped.calls == 0);
+    link.manager.poll(0x00000010u);
+    EXPECT(wrapped.calls == 1 && wrapped.status == Status::Timeout);
+}
+
+/// @brief SetIは再送せず期限で完了し、SetI_SNAを受信した場合はNotAvailable
+void testSetI() {
+    Link link;
+    Result accepted;
+    Result rejected;
+    Request request = makeRequest(Service::SetI);
+    EXPECT(link.manager.submit(request, 0, accepted.callback(), 100));
+    EXPECT(link.manager.submit(request, 0, rejected.callback(), 100));
+    const std::vector<uint8_t> response = makeTestResponse(link.sent[1], Service::SetI_SNA, {{0xE7, {}}});
+    EXPECT(link.manager.receive(response.data(), response.size()));
+    EXPECT(rejected.calls == 1 && rejected.status == Status::NotAvailable);
+    link.manager.poll(100);
+    EXPECT(accepted.calls == 1 && accepted.status == Status::Completed && !accepted.valid);
+    EXPECT(link.sent.size() == 2);
+}
+
+/// @brief cancel()した要求はコールバックせず、応答も照合しない
+void testCancel() {
+    Link link;
+    Result result;
+    Request request = makeRequest();
+    EXPECT(link.manager.submit(request, 0, result.callback()));
+    EXPECT(link.manager.cancel(request.data.EHEAD.TransactionId));
+    EXPECT(!link.manager.cancel(request.data.EHEAD.TransactionId));
+    EXPECT(link.manager.inFlight() == 0);
+    const std::vector<uint8_t> response = makeTestResponse(link.sent[0], Service::Get_Res, {{0xE7, {0x00, 0x00, 0x01, 0x00}}});
+    EXPECT(!link.manager.receive(response.data(), response.size()));
+    link.manager.poll(Manager::defaultTimeout * 8);
+    EXPECT(result.calls == 0 && link.sent.size() == 1);
+}
+
+} // namespace
+
+int main() {
+    testSubmit();
+    testRetry();
+    testSetI();
+    testCancel();
+    return testResult();
+}
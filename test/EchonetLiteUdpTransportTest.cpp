@@ -0,0 +1,65 @@
+#include "EchonetLiteTest.hpp"
+#include "EchonetLiteUdpTransport.hpp"
+#include <memory>
+#include <vector>
+
+/// @brief 127.0.0.1上でsendmmsgで一括送信したフレームが、recvmmsgで順序どおりに送信元アドレス付きで届くこと
+int main() {
+    constexpr size_t frameCount = 20;
+    // 送信側は8フレーム、受信側は4フレームずつ処理し、複数回のsendmmsg・recvmmsgを通す
+    auto sender   = std::make_unique<EchonetLiteUdpTransport<8>>();
+    auto receiver = std::make_unique<EchonetLiteUdpTransport<4>>();
+    const in_addr_t loopback = htonl(INADDR_LOOPBACK);
+    EXPECT(sender->open(0, loopback, false));
+    EXPECT(receiver->open(0, loopback, false));
+    EXPECT(sender->localPort() != 0);
+    EXPECT(receiver->localPort() != 0);
+
+    const sockaddr_in destination = EchonetLiteUdpTransport<8>::makeAddress(INADDR_LOOPBACK, receiver->localPort());
+    for (uint16_t i = 0; i < frameCount; i++) {
+        const std::vector<uint8_t> frame = makeMeterFrame(0x0100 + i);
+        EXPECT(sender->send(destination, frame.data(), frame.size()));
+    }
+    // ヘッダ長に満たないフレームは通知されない
+    const uint8_t malformed[] = {0x10, 0x81, 0x00};
+    EXPECT(sender->send(destination, malformed, sizeof(malformed)));
+    EXPECT(sender->flush() == 5);
+    EXPECT(sender->queued() == 0 && sender->droppedFrames() == 0);
+
+    std::vector<uint16_t> transactionIds;
+    size_t wrongSource = 0;
+    for (int attempt = 0; attempt < 50 && transactionIds.size() < frameCount; attempt++) {
+        receiver->poll(100, [&](const sockaddr_in &from, const EchonetLite::EchonetLiteFrameView &frame) {
+            if (from.sin_addr.s_addr != loopback || ntohs(from.sin_port) != sender->localPort()) {
+                wrongSource++;
+            }
+            EchonetLite::EchonetLitePropertyView property;
+            EXPECT(frame.find(0xE7, &property) && property.propertyDataCounter == 4);
+            transactionIds.push_back(frame.EHEAD.TransactionId);
+        });
+    }
+
+    EXPECT(transactionIds.size() == frameCount);
+    EXPECT(wrongSource == 0);
+    for (size_t i = 0; i < transactionIds.size(); i++) {
+        EXPECT(transactionIds[i] == 0x0100 + i);
+    }
+    EXPECT(receiver->poll(0, [](const sockaddr_in &, const EchonetLite::EchonetLiteFrameView &) {}) == 0);
+
+    // 受信バッファに収まらないデータグラムは通知せずに数える
+    std::vector<uint8_t> oversized = makeMeterFrame(0x0200);
+    oversized.resize(EchonetLiteUdpTransport<4>::maxFrameBytes + 1);
+    const int raw = socket(AF_INET, SOCK_DGRAM, 0);
+    EXPECT(raw >= 0);
+    EXPECT(sendto(raw, oversized.data(), oversized.size(), 0, reinterpret_cast<const sockaddr *>(&destination), sizeof(destination)) == static_cast<ssize_t>(oversized.size()));
+    const std::vector<uint8_t> last = makeMeterFrame(0x0201);
+    EXPECT(sendto(raw, last.data(), last.size(), 0, reinterpret_cast<const sockaddr *>(&destination), sizeof(destination)) == static_cast<ssize_t>(last.size()));
+    close(raw);
+    transactionIds.clear();
+    for (int attempt = 0; attempt < 50 && transactionIds.size() < 1; attempt++) {
+        receiver->poll(100, [&](const sockaddr_in &, const EchonetLite::EchonetLiteFrameView &frame) { transactionIds.push_back(frame.EHEAD.TransactionId); });
+    }
+    EXPECT(transactionIds.size() == 1 && transactionIds[0] == 0x0201);
+    EXPECT(receiver->truncatedFrames() == 1);
+    return testResult();
+}
@@ -0,0 +1,179 @@
+#include "EchonetLiteTest.hpp"
+#include "LowVoltageSmartElectricEnergyMeter.hpp"
+#include <vector>
+
+namespace {
+
+using Meter = LowVoltageSmartElectricEnergyMeterClass;
+
+/// @brief 32bitビッグエンディアンのEDT
+std::vector<uint8_t> uint32Edt(const uint32_t value) {
+    return {static_cast<uint8_t>(value >> 24), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value)};
+}
+
+/// @brief 係数・単位を含む応答（直前の要求のTID）の取り込み
+bool loadMeter(Meter *const meter, const uint32_t coefficient, const uint8_t unit, const std::vector<TestProperty> &extra = {}) {
+    std::vector<TestProperty> properties = {{0xD3, uint32Edt(coefficient)}, {0xE1, {unit}}};
+    properties.insert(properties.end(), extra.begin(), extra.end());
+    const std::vector<uint8_t> response = makeTestFrame(meter->nextTransactionId, testMeter, testController, EchonetLite::EchonetLiteService::Get_Res, properties);
+    return meter->load(EchonetLite::load(response.data(), response.size()));
+}
+
+/// @brief 積算電力量計測値履歴（0xE2、収集日1）のEDT
+std::vector<uint8_t> historyEdt(const std::vector<uint32_t> &values) {
+    std::vector<uint8_t> edt = {0x00, 0x01};
+    for (size_t i = 0; i < 48; i++) {
+        const std::vector<uint8_t> slot = uint32Edt(i < values.size() ? values[i] : 0xFFFFFFFE);
+        edt.insert(edt.end(), slot.begin(), slot.end());
+    }
+    return edt;
+}
+
+/// @brief 積算電力量計測値履歴２・３（0xEC・0xEE、2026/10/17 12:30収集）のEDT
+std::vector<uint8_t> historyWithDateEdt(const uint8_t count, const std::vector<std::pair<uint32_t, uint32_t>> &values) {
+    std::vector<uint8_t> edt = {0x07, 0xEA, 10, 17, 12, 30, count};
+    for (const std::pair<uint32_t, uint32_t> &value : values) {
+        const std::vector<uint8_t> positive = uint32Edt(value.first);
+        const std::vector<uint8_t> negative = uint32Edt(value.second);
+        edt.insert(edt.end(), positive.begin(), positive.end());
+        edt.insert(edt.end(), negative.begin(), negative.end());
+    }
+    return edt;
+}
+
+/// @brief 積算電力量計測値履歴（0xE2・0xE4）は未計測のコマを読み飛ばして列挙する
+void testHistory() {
+    Meter meter;
+    EXPECT(loadMeter(&meter, 1, 0x01, {{0xE2, historyEdt({10, 0xFFFFFFFE, 30})}, {0xE4, {0x00, 0x01, 0x00}}}));
+    Meter::CumulativeEnergyHistory history;
+    EXPECT(meter.getCumulativeEnergyHistoryPositive(&history));
+    EXPECT(history.day == 1 && history.slots.size() == 48);
+    std::vector<uint8_t> indexes;
+    std::vector<uint32_t> values;
+    for (const Meter::CumulativeEnergyHistoryRange<1>::Slot &slot : history.slots) {
+        indexes.push_back(slot.index);
+        values.push_back(slot.value[0]);
+        EXPECT(slot.energy[0] > slot.value[0] * 0.0999f && slot.energy[0] < slot.value[0] * 0.1001f);
+    }
+    EXPECT((indexes == std::vector<uint8_t>{0, 2}));
+    EXPECT((values == std::vector<uint32_t>{10, 30}));
+
+    std::vector<int64_t> converted(48, 0);
+    EXPECT(history.slots.convert(converted.data()) == 2);
+    EXPECT(converted[0] == 1000000 && converted[1] == Meter::CumulativeEnergyHistoryRange<1>::invalidMilliWattHour && converted[2] == 3000000);
+    EXPECT(history.slots.convert(converted.data(), 1) == 0);
+
+    // PDCが48コマ分でない履歴は無効
+    EXPECT(!meter.getCumulativeEnergyHistoryNegative(&history));
+}
+
+/// @brief 積算電力量計測値履歴２・３（0xEC・0xEE）は収集日時と正逆の計測値を持つ
+void testHistoryWithDate() {
+    const std::vector<std::pair<uint32_t, uint32_t>> values = {{100, 5}, {0xFFFFFFFE, 6}, {90, 4}};
+    Meter meter;
+    EXPECT(loadMeter(&meter, 1, 0x01, {{0xEC, historyWithDateEdt(3, values)}, {0xEE, historyWithDateEdt(3, values)}}));
+    Meter::CumulativeEnergyHistoryWithDate history;
+    EXPECT(meter.getCumulativeEnergyHistory2(&history));
+    EXPECT(history.year == 2026 && history.month == 10 && history.day == 17 && history.hour == 12 && history.minute == 30);
+    EXPECT(history.slots.size() == 3);
+    std::vector<uint8_t> indexes;
+    for (const Meter::CumulativeEnergyHistoryRange<2>::Slot &slot : history.slots) {
+        indexes.push_back(slot.index);
+        EXPECT(slot.value[0] == values[slot.index].first && slot.value[1] == values[slot.index].second);
+    }
+    EXPECT((indexes == std::vector<uint8_t>{0, 2}));
+
+    std::vector<int64_t> positive(3, 0);
+    std::vector<int64_t> negative(3, 0);
+    EXPECT(history.slots.convert(positive.data(), 0) == 2);
+    EXPECT(history.slots.convert(negative.data(), 1) == 3);
+    EXPECT((positive == std::vector<int64_t>{10000000, Meter::CumulativeEnergyHistoryRange<2>::invalidMilliWattHour, 9000000}));
+    EXPECT((negative == std::vector<int64_t>{500000, 600000, 400000}));
+    EXPECT(history.slots.convert(positive.data(), 2) == 0);
+    EXPECT(meter.getCumulativeEnergyHistory3(&history) && history.slots.size() == 3);
+
+    // コマ数は0xECが12、0xEEが10まで。コマ数とPDCが合わない履歴は無効
+    const std::vector<std::pair<uint32_t, uint32_t>> eleven(11, {1, 1});
+    EXPECT(loadMeter(&meter, 1, 0x01, {{0xEC, historyWithDateEdt(11, eleven)}, {0xEE, historyWithDateEdt(11, eleven)}}));
+    EXPECT(meter.getCumulativeEnergyHistory2(&history) && history.slots.size() == 11);
+    EXPECT(!meter.getCumulativeEnergyHistory3(&history));
+    const std::vector<std::pair<uint32_t, uint32_t>> thirteen(13, {1, 1});
+    EXPECT(loadMeter(&meter, 1, 0x01, {{0xEC, historyWithDateEdt(13, thirteen)}, {0xEE, historyWithDateEdt(4, values)}}));
+    EXPECT(!meter.getCumulativeEnergyHistory2(&history));
+    EXPECT(!meter.getCumulativeEnergyHistory3(&history));
+    EXPECT(loadMeter(&meter, 1, 0x01, {{0xEC, historyWithDateEdt(0, {})}}));
+    EXPECT(!meter.getCumulativeEnergyHistory2(&history));
+}
+
+/// @brief 0xE1の単位コードごとの計測値1あたりの電力量[mWh]
+void testUnitTable() {
+    struct UnitCase {
+        uint8_t code;
+        int64_t scaleMilli;
+    };
+    constexpr UnitCase units[] = {
+        {0x00, 1000000},
+        {0x01, 100000},
+        {0x02, 10000},
+        {0x03, 1000},
+        {0x04, 100},
+        {0x0A, 10000000},
+        {0x0B, 100000000},
+        {0x0C, 1000000000},
+        {0x0D, 10000000000},
+    };
+    for (const UnitCase &unit : units) {
+        Meter meter;
+        EXPECT(loadMeter(&meter, 1, unit.code, {{0xE0, uint32Edt(12345)}, {0xE3, uint32Edt(0)}}));
+        EXPECT(meter.getCumulativeEnergyScaleMilli() == unit.scaleMilli);
+        int64_t energy = -1;
+        EXPECT(meter.getCumulativeEnergyPositiveMilliWattHour(&energy) && energy == 12345 * unit.scaleMilli);
+        EXPECT(meter.getCumulativeEnergyNegativeMilliWattHour(&energy) && energy == 0);
+    }
+
+    // 規定外の単位コードは直前の単位のまま
+    Meter meter;
+    EXPECT(loadMeter(&meter, 1, 0x02));
+    EXPECT(loadMeter(&meter, 1, 0x05));
+    EXPECT(meter.getCumulativeEnergyScaleMilli() == 10000);
+}
+
+/// @brief 係数・単位が大きくても、計測値との積が収まる限り変換する
+void testLargeScale() {
+    // 係数10・単位10000kWh（計測値の最大値との積は収まらないが、実際の計測値では収まる）
+    Meter meter;
+    EXPECT(loadMeter(&meter, 10, 0x0D, {{0xE0, uint32Edt(12345678)}}));
+    EXPECT(meter.getCumulativeEnergyScaleMilli() == 100000000000);
+    int64_t energy = -1;
+    EXPECT(meter.getCumulativeEnergyPositiveMilliWattHour(&energy) && energy == 1234567800000000000);
+
+    // 係数999999・単位10000kWhでは922までが収まる
+    constexpr int64_t maxScale = 999999LL * 10000000000LL;
+    EXPECT(loadMeter(&meter, 999999, 0x0D, {{0xE0, uint32Edt(922)}, {0xE3, uint32Edt(923)}}));
+    EXPECT(meter.getCumulativeEnergyScaleMilli() == maxScale);
+    EXPECT(meter.getCumulativeEnergyPositiveMilliWattHour(&energy) && energy == 922 * maxScale);
+    energy = -1;
+    EXPECT(!meter.getCumulativeEnergyNegativeMilliWattHour(&energy) && energy == -1);
+
+    // 履歴の一括変換も計測値で判定し、収まらないコマがあれば書き換えない
+    EXPECT(loadMeter(&meter, 999999, 0x0D, {{0xE2, historyEdt({0, 100, 922})}, {0xE4, historyEdt({0, 923})}}));
+    Meter::CumulativeEnergyHistory history;
+    std::vector<int64_t> converted(48, 0);
+    EXPECT(meter.getCumulativeEnergyHistoryPositive(&history));
+    EXPECT(history.slots.convert(converted.data()) == 3);
+    EXPECT(converted[2] == 922 * maxScale && converted[3] == Meter::CumulativeEnergyHistoryRange<1>::invalidMilliWattHour);
+    EXPECT(meter.getCumulativeEnergyHistoryNegative(&history));
+    std::fill(converted.begin(), converted.end(), 7);
+    EXPECT(history.slots.convert(converted.data()) == 0);
+    EXPECT(std::all_of(converted.begin(), converted.end(), [](const int64_t value) { return value == 7; }));
+}
+
+} // namespace
+
+int main() {
+    testUnitTable();
+    testLargeScale();
+    testHistory();
+    testHistoryWithDate();
+    return testResult();
+}